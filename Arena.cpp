@@ -0,0 +1,165 @@
+/**
+ * @file Arena.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief bump allocator for the strings and containers of deserialized objects
+ * @version 1.0
+ * @date 2020-09-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Arena.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a new Arena
+ *
+ * @param capacity bytes of the first block, allocated right away
+ */
+inline Serialization::Arena::Arena(const std::size_t capacity) :
+    first(new std::byte[std::max<std::size_t>(capacity, 1)]),
+    capacity(std::max<std::size_t>(capacity, 1)),
+    overflow(),
+    blockCapacity(this->capacity),
+    cursor(first.get()),
+    end(first.get() + this->capacity),
+    size(0),
+    allocationCount(0)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief frees everything allocated so far.
+ *
+ * @details Only moves the pointer back to the start of the first block,
+ * unless more blocks were needed: then the first block is replaced by one
+ * that holds all of them.
+ */
+inline void Serialization::Arena::reset()
+{
+    if (!overflow.empty()) {
+        overflow.clear();
+        capacity = std::max(2 * capacity, size + alignof(std::max_align_t));
+        first.reset(new std::byte[capacity]);
+    }
+    blockCapacity = capacity;
+    cursor = first.get();
+    end = first.get() + capacity;
+    size = 0;
+    allocationCount = 0;
+}
+
+/**
+ * @brief gets the bytes handed out since the last reset()
+ *
+ * @return std::size_t number of bytes, without alignment
+ */
+inline std::size_t Serialization::Arena::getSize() const
+{
+    return size;
+}
+
+/**
+ * @brief gets the size of the first block, the memory used without touching the heap
+ *
+ * @return std::size_t number of bytes
+ */
+inline std::size_t Serialization::Arena::getCapacity() const
+{
+    return capacity;
+}
+
+inline std::size_t Serialization::Arena::getAllocationCount() const
+{
+    return allocationCount;
+}
+
+/**
+ * @brief puts a std::pmr container on a memory resource.
+ *
+ * @details A std::pmr container keeps the resource it was constructed
+ * with, assigning does not change it. So a container on another resource
+ * is replaced by an empty one on the given resource, before the
+ * deserializers fill it. Other types and a nullptr resource are left alone.
+ *
+ * @tparam ContainerT any type, only std::pmr::string and std::pmr::vector are bound
+ * @param container container to bind, emptied if it is replaced
+ * @param resource resource to allocate from, nullptr to keep the current one
+ */
+template <class ContainerT>
+void Serialization::Arena::bind(ContainerT& container, std::pmr::memory_resource* const resource)
+{
+    if constexpr (TypeTraits::usesMemoryResource<ContainerT>) {
+        if ((resource != nullptr) && (container.get_allocator().resource() != resource)) {
+            std::destroy_at(&container);
+            std::construct_at(&container, typename ContainerT::allocator_type(resource));
+        }
+    }
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief takes the next bytes of the current block, aligned.
+ *
+ * @param bytes number of bytes
+ * @param alignment power of two
+ * @return void* memory, valid until reset()
+ */
+inline void* Serialization::Arena::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    void* memory = cursor;
+    std::size_t space = end - cursor;
+    if (std::align(alignment, bytes, memory, space) == nullptr) {
+        addBlock(bytes + alignment);
+        memory = cursor;
+        space = end - cursor;
+        std::align(alignment, bytes, memory, space);
+    }
+    cursor = static_cast<std::byte*>(memory) + bytes;
+    size += bytes;
+    ++allocationCount;
+    return memory;
+}
+
+/**
+ * @brief does nothing, memory is freed by reset()
+ */
+inline void Serialization::Arena::do_deallocate(void* const memory, const std::size_t bytes, const std::size_t alignment)
+{
+}
+
+inline bool Serialization::Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief continues in a new block, twice as large as the current one.
+ *
+ * @param minimumCapacity bytes the new block has to hold at least
+ */
+inline void Serialization::Arena::addBlock(const std::size_t minimumCapacity)
+{
+    blockCapacity = std::max(2 * blockCapacity, minimumCapacity);
+    overflow.emplace_back(new std::byte[blockCapacity]);
+    cursor = overflow.back().get();
+    end = cursor + blockCapacity;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,95 @@
+/**
+ * @file Arena.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief bump allocator for the strings and containers of deserialized objects
+ * @version 1.0
+ * @date 2020-09-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class Arena;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TypeTraits.h"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief bump allocator for the strings and containers of deserialized objects
+ *
+ * @details Hands out memory by moving a pointer through a block,
+ * deallocate does nothing and reset() frees everything at once.
+ * A block that ran full is followed by a twice as large one, and reset()
+ * grows the first block to everything allocated since the last reset,
+ * so once the largest message or batch has been seen, allocating and
+ * freeing never touch the heap.
+ * Pass it to deserialize(...), which puts every std::pmr member it fills
+ * on the arena. Objects using the arena have to be destroyed or
+ * discarded before reset(). Not thread safe, use one arena per thread.
+ */
+class Arena : public std::pmr::memory_resource
+{
+    // delete default constructors
+    Arena(const Arena& other) = delete;
+    Arena& operator=(const Arena& other) = delete;
+public:
+    explicit Arena(const std::size_t capacity = 4096);
+
+    void reset();
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+    std::size_t getAllocationCount() const;
+
+    template <class ContainerT>
+    static void bind(ContainerT& container, std::pmr::memory_resource* const resource);
+
+protected:
+    virtual void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+    virtual void do_deallocate(void* const memory, const std::size_t bytes, const std::size_t alignment) override;
+    virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    void addBlock(const std::size_t minimumCapacity);
+
+    /** first block, kept over reset() */
+    std::unique_ptr<std::byte[]> first;
+    /** bytes of the first block */
+    std::size_t capacity;
+    /** blocks allocated after the first one ran full, freed by reset() */
+    std::vector<std::unique_ptr<std::byte[]>> overflow;
+    /** bytes of the current block */
+    std::size_t blockCapacity;
+    /** next free byte of the current block */
+    std::byte* cursor;
+    /** end of the current block */
+    std::byte* end;
+    /** bytes handed out since the last reset() */
+    std::size_t size;
+    /** allocations since the last reset() */
+    std::size_t allocationCount;
+};
+} // Serialization
+
+// include src
+#include "Arena.cpp"
+#endif //__ARENA_H__
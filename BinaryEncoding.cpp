@@ -0,0 +1,263 @@
+/**
+ * @file BinaryEncoding.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief fixed width little endian encoding of primitive values
+ * @version 1.0
+ * @date 2020-08-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryEncoding.h"
+#include <cassert>
+#include <limits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief writes an integer with sizeof(IntegerT) bytes, little endian.
+ *
+ * @details The shifts compile to a single store on little endian machines.
+ *
+ * @tparam IntegerT fixed width integral type
+ * @param writer writer to write to
+ * @param value value to write
+ */
+template <class IntegerT>
+void Serialization::BinaryEncoding::write(Writer& writer, const IntegerT value)
+{
+    static_assert(std::is_integral_v<IntegerT>, "BinaryEncoding only writes integers");
+    using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+    char bytes[sizeof(IntegerT)];
+    for (std::size_t ii = 0; ii < sizeof(IntegerT); ++ii) {
+        bytes[ii] = static_cast<char>(static_cast<UnsignedT>(value) >> (8 * ii));
+    }
+    writer.write(bytes, sizeof(IntegerT));
+}
+
+/**
+ * @brief writes the length prefix of a string or container.
+ *
+ * @details Longer contents are a programming error, the prefix would wrap
+ * and the reader would take the following bytes for the next value.
+ *
+ * @param writer writer to write to
+ * @param length number of bytes or elements, at most the maximum of LengthType
+ */
+inline void Serialization::BinaryEncoding::writeLength(Writer& writer, const std::size_t length)
+{
+    assert(length <= std::numeric_limits<LengthType>::max());
+    write(writer, static_cast<LengthType>(length));
+}
+
+/**
+ * @brief reads a little endian integer of sizeof(IntegerT) bytes.
+ *
+ * @tparam IntegerT fixed width integral type
+ * @param position at least sizeof(IntegerT) bytes of input
+ * @return IntegerT decoded value
+ */
+template <class IntegerT>
+IntegerT Serialization::BinaryEncoding::read(const char* const position)
+{
+    static_assert(std::is_integral_v<IntegerT>, "BinaryEncoding only reads integers");
+    using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+    UnsignedT value = 0;
+    for (std::size_t ii = 0; ii < sizeof(IntegerT); ++ii) {
+        value |= static_cast<UnsignedT>(static_cast<unsigned char>(position[ii])) << (8 * ii);
+    }
+    return static_cast<IntegerT>(value);
+}
+
+/**
+ * @brief checks if the memory of a value equals its encoding.
+ *
+ * @details Such values can be written with a single copy of
+ * sizeof(ValueT) bytes, arrays of them with one copy for all.
+ *
+ * @tparam ValueT any serializeable type
+ * @return true if the memory can be copied to the output
+ */
+template <class ValueT>
+constexpr bool Serialization::BinaryEncoding::isBulkEncodable()
+{
+    return matchesEncoding<ValueT, true>();
+}
+
+/**
+ * @brief checks if the encoding can be copied into the memory of a value.
+ *
+ * @details Like isBulkEncodable(), but without bools, as a byte other
+ * than 0 or 1 has to be rejected instead of being copied into a bool.
+ *
+ * @tparam ValueT any serializeable type
+ * @return true if the input can be copied to memory
+ */
+template <class ValueT>
+constexpr bool Serialization::BinaryEncoding::isBulkDecodable()
+{
+    return matchesEncoding<ValueT, false>();
+}
+
+/**
+ * @brief number of bytes of a value that do not depend on its content.
+ *
+ * @details Primitives count completely, strings and std::vector only
+ * their length prefix, std::optional its presence byte.
+ *
+ * @tparam ValueT any serializeable type
+ * @return constexpr std::size_t bytes known at compile time
+ */
+template <class ValueT>
+constexpr std::size_t Serialization::BinaryEncoding::fixedSize()
+{
+    if constexpr (std::is_same_v<char, ValueT> || std::is_same_v<bool, ValueT>) {
+        return 1;
+    } else if constexpr (std::is_same_v<int, ValueT>) {
+        return sizeof(IntType);
+    } else if constexpr (TypeTraits::isInteger<ValueT> || TypeTraits::isFloatingPoint<ValueT>) {
+        return sizeof(ValueT);
+    } else if constexpr (TypeTraits::isFixedSequence<ValueT>) {
+        return TypeTraits::fixedLength<ValueT> * fixedSize<typename ValueT::value_type>();
+    } else if constexpr (TypeTraits::isOptional<ValueT>) {
+        return 1;
+    } else if constexpr (TypeTraits::isDescribed<ValueT>) {
+        return membersFixedSize<ValueT>(std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+    } else {
+        // const char*, std::string and std::vector
+        return sizeof(LengthType);
+    }
+}
+
+/**
+ * @brief checks if every value of a type is encoded with fixedSize() bytes.
+ *
+ * @tparam ValueT any serializeable type
+ * @return true if the size does not depend on the content
+ */
+template <class ValueT>
+constexpr bool Serialization::BinaryEncoding::isFixedSize()
+{
+    if constexpr (TypeTraits::isPrimitive<ValueT> && !std::is_same_v<const char*, ValueT>) {
+        return true;
+    } else if constexpr (TypeTraits::isFixedSequence<ValueT>) {
+        return isFixedSize<typename ValueT::value_type>();
+    } else if constexpr (TypeTraits::isDescribed<ValueT>) {
+        return membersAreFixedSize<ValueT>(std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+    } else {
+        return false;
+    }
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief compares memory layout and encoding of a type.
+ *
+ * @tparam ValueT any serializeable type
+ * @tparam AllowBool whether bools count as matching
+ * @return true if memory and encoding are equal
+ */
+template <class ValueT, bool AllowBool>
+constexpr bool Serialization::BinaryEncoding::matchesEncoding()
+{
+    if constexpr (std::is_same_v<char, ValueT>) {
+        return true;
+    } else if constexpr (std::is_same_v<bool, ValueT>) {
+        return AllowBool && (sizeof(bool) == 1);
+    } else if constexpr (std::is_same_v<int, ValueT>) {
+        return (sizeof(int) == sizeof(IntType)) && (std::endian::native == std::endian::little);
+    } else if constexpr (TypeTraits::isInteger<ValueT>) {
+        return (sizeof(ValueT) == 1) || (std::endian::native == std::endian::little);
+    } else if constexpr (TypeTraits::isFloatingPoint<ValueT>) {
+        return std::numeric_limits<ValueT>::is_iec559 && (std::endian::native == std::endian::little);
+    } else if constexpr (TypeTraits::isFixedSequence<ValueT>) {
+        return matchesEncoding<typename ValueT::value_type, AllowBool>();
+    } else if constexpr (TypeTraits::isDescribed<ValueT>) {
+        if constexpr (Descriptor::isDenselyDescribed<ValueT>()) {
+            return membersMatchEncoding<ValueT, AllowBool>(
+                std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+        } else {
+            return false;
+        }
+    } else {
+        // pointers and containers are written as the data they point to
+        return false;
+    }
+}
+
+template <class SerializeableT, bool AllowBool, std::size_t... Indices>
+constexpr bool Serialization::BinaryEncoding::membersMatchEncoding(std::index_sequence<Indices...>)
+{
+    return (true && ... && memberMatchesEncoding<AllowBool>(Descriptor::getDescriptor<SerializeableT, Indices>()));
+}
+
+template <bool AllowBool, class SerializeableT, class MemberT>
+constexpr bool Serialization::BinaryEncoding::memberMatchesEncoding(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return MemberDescriptor<SerializeableT, MemberT>::isWriteable &&
+        matchesEncoding<typename MemberDescriptor<SerializeableT, MemberT>::ValueType, AllowBool>();
+}
+
+template <bool AllowBool, class SerializeableT, class ReturnT, class... ArgTs>
+constexpr bool Serialization::BinaryEncoding::memberMatchesEncoding(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return true;
+}
+
+template <class SerializeableT, std::size_t... Indices>
+constexpr std::size_t Serialization::BinaryEncoding::membersFixedSize(std::index_sequence<Indices...>)
+{
+    return (std::size_t(0) + ... + memberFixedSize(Descriptor::getDescriptor<SerializeableT, Indices>()));
+}
+
+template <class SerializeableT, class MemberT>
+constexpr std::size_t Serialization::BinaryEncoding::memberFixedSize(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return fixedSize<typename MemberDescriptor<SerializeableT, MemberT>::ValueType>();
+}
+
+template <class SerializeableT, class ReturnT, class... ArgTs>
+constexpr std::size_t Serialization::BinaryEncoding::memberFixedSize(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return 0;
+}
+
+template <class SerializeableT, std::size_t... Indices>
+constexpr bool Serialization::BinaryEncoding::membersAreFixedSize(std::index_sequence<Indices...>)
+{
+    return (true && ... && memberIsFixedSize(Descriptor::getDescriptor<SerializeableT, Indices>()));
+}
+
+template <class SerializeableT, class MemberT>
+constexpr bool Serialization::BinaryEncoding::memberIsFixedSize(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return isFixedSize<typename MemberDescriptor<SerializeableT, MemberT>::ValueType>();
+}
+
+template <class SerializeableT, class ReturnT, class... ArgTs>
+constexpr bool Serialization::BinaryEncoding::memberIsFixedSize(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return true;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
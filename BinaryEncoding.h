@@ -0,0 +1,136 @@
+/**
+ * @file BinaryEncoding.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief fixed width little endian encoding of primitive values
+ * @version 1.0
+ * @date 2020-08-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BINARYENCODING_H__
+#define __BINARYENCODING_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class BinaryEncoding;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Descriptor.h"
+#include "TypeTraits.h"
+#include "Writer.h"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief fixed width little endian encoding of primitive values
+ *
+ * @details Shared by the binary serializer and deserializer.
+ * Integers are always written least significant byte first,
+ * independent of the byte order of the machine.
+ * Classes whose memory already equals their encoding can be copied
+ * as a whole, see isBulkEncodable() and isBulkDecodable().
+ */
+class BinaryEncoding
+{
+    // delete default constructors
+    BinaryEncoding() = delete;
+    BinaryEncoding(const BinaryEncoding& other) = delete;
+    BinaryEncoding& operator=(const BinaryEncoding& other) = delete;
+public:
+    /** int is written with this width on every platform */
+    using IntType = std::int32_t;
+    /** type of the length prefix of strings, containers can not hold more */
+    using LengthType = std::uint32_t;
+
+    /** type tags written by serializeStructure(...) */
+    static constexpr char typeInt = 'I';
+    static constexpr char typeChar = 'C';
+    static constexpr char typeBool = 'B';
+    static constexpr char typeString = 'S';
+    static constexpr char typeInt8 = 'b';
+    static constexpr char typeUInt8 = 'u';
+    static constexpr char typeInt16 = 'h';
+    static constexpr char typeUInt16 = 'w';
+    static constexpr char typeUInt32 = 'U';
+    static constexpr char typeInt64 = 'l';
+    static constexpr char typeUInt64 = 'L';
+    static constexpr char typeFloat = 'F';
+    static constexpr char typeDouble = 'D';
+    static constexpr char typeVector = 'V';
+    static constexpr char typeArray = 'A';
+    static constexpr char typeOptional = 'O';
+
+    template <class IntegerT>
+    static void write(Writer& writer, const IntegerT value);
+
+    static void writeLength(Writer& writer, const std::size_t length);
+
+    template <class IntegerT>
+    static IntegerT read(const char* const position);
+
+    template <class ValueT>
+    static constexpr bool isBulkEncodable();
+
+    template <class ValueT>
+    static constexpr bool isBulkDecodable();
+
+    template <class ValueT>
+    static constexpr std::size_t fixedSize();
+
+    template <class ValueT>
+    static constexpr bool isFixedSize();
+
+private:
+    template <class ValueT, bool AllowBool>
+    static constexpr bool matchesEncoding();
+
+    template <class SerializeableT, bool AllowBool, std::size_t... Indices>
+    static constexpr bool membersMatchEncoding(std::index_sequence<Indices...>);
+
+    template <bool AllowBool, class SerializeableT, class MemberT>
+    static constexpr bool memberMatchesEncoding(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <bool AllowBool, class SerializeableT, class ReturnT, class... ArgTs>
+    static constexpr bool memberMatchesEncoding(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT, std::size_t... Indices>
+    static constexpr std::size_t membersFixedSize(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    static constexpr std::size_t memberFixedSize(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static constexpr std::size_t memberFixedSize(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT, std::size_t... Indices>
+    static constexpr bool membersAreFixedSize(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    static constexpr bool memberIsFixedSize(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static constexpr bool memberIsFixedSize(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+};
+} // Serialization
+
+// template functions, include src
+#include "BinaryEncoding.cpp"
+#endif //__BINARYENCODING_H__
@@ -0,0 +1,286 @@
+/**
+ * @file BinaryScanner.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief finds the end of binary objects in chunked input
+ * @version 1.0
+ * @date 2020-08-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryScanner.h"
+#include <algorithm>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class SerializeableT>
+Serialization::BinaryScanner<SerializeableT>::BinaryScanner() :
+    frames(),
+    skipping(0),
+    header(),
+    headerSize(0),
+    position(nullptr),
+    end(nullptr),
+    started(false),
+    complete(false),
+    error(DeserializationError::None)
+{
+    push(&step<SerializeableT>);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief scans the next chunk of the current object.
+ *
+ * @details Every byte is looked at once at most, skipped values
+ * not at all, no matter how the input is split.
+ *
+ * @param data next chunk of the input
+ * @param size number of bytes in data
+ * @return std::size_t number of bytes belonging to the object, all of
+ * them if it is not complete yet
+ */
+template <class SerializeableT>
+std::size_t Serialization::BinaryScanner<SerializeableT>::scan(const char* const data, const std::size_t size)
+{
+    position = data;
+    end = data + size;
+    while (!complete && (error == DeserializationError::None)) {
+        if (skipping != 0) {
+            const std::size_t skipped = std::min<std::size_t>(skipping, end - position);
+            position += skipped;
+            skipping -= skipped;
+            if (skipping != 0) {
+                break;
+            }
+        }
+        if (frames.empty()) {
+            complete = true;
+        } else if (!frames.back().step(*this)) {
+            break;
+        }
+    }
+    started = started || (position != data);
+    return position - data;
+}
+
+/**
+ * @brief checks if a byte of the object was scanned
+ *
+ * @return true if the object is started
+ */
+template <class SerializeableT>
+bool Serialization::BinaryScanner<SerializeableT>::isStarted() const
+{
+    return started;
+}
+
+/**
+ * @brief checks if the end of the object was found
+ *
+ * @return true if the object is complete
+ */
+template <class SerializeableT>
+bool Serialization::BinaryScanner<SerializeableT>::isComplete() const
+{
+    return complete;
+}
+
+template <class SerializeableT>
+Serialization::DeserializationError Serialization::BinaryScanner<SerializeableT>::getError() const
+{
+    return error;
+}
+
+/**
+ * @brief starts scanning the next object, the stack keeps its memory
+ */
+template <class SerializeableT>
+void Serialization::BinaryScanner<SerializeableT>::reset()
+{
+    frames.clear();
+    skipping = 0;
+    headerSize = 0;
+    started = false;
+    complete = false;
+    error = DeserializationError::None;
+    push(&step<SerializeableT>);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief scans the value on top of the stack.
+ *
+ * @details Fixed size values are skipped at once, strings after their
+ * length. Sequences and classes stay on the stack while their elements
+ * and members are pushed one after the other.
+ *
+ * @tparam ValueT type of the value
+ * @param scanner scanner to work on
+ * @return true if the step is done, false if it needs more input
+ */
+template <class SerializeableT>
+template <class ValueT>
+bool Serialization::BinaryScanner<SerializeableT>::step(BinaryScanner& scanner)
+{
+    Frame& frame = scanner.frames.back();
+    if constexpr (BinaryEncoding::isFixedSize<ValueT>()) {
+        scanner.frames.pop_back();
+        scanner.skipping = BinaryEncoding::fixedSize<ValueT>();
+    } else if constexpr (std::is_same_v<const char*, ValueT> || TypeTraits::isString<ValueT>) {
+        std::size_t length = 0;
+        if (!scanner.readHeader(sizeof(BinaryEncoding::LengthType), length)) {
+            return false;
+        }
+        scanner.frames.pop_back();
+        scanner.skipping = length;
+    } else if constexpr (TypeTraits::isOptional<ValueT>) {
+        std::size_t hasValue = 0;
+        if (!scanner.readHeader(1, hasValue)) {
+            return false;
+        }
+        if (hasValue > 1) {
+            return scanner.fail(DeserializationError::TypeMismatch);
+        }
+        scanner.frames.pop_back();
+        if (hasValue != 0) {
+            scanner.push(&step<typename ValueT::value_type>);
+        }
+    } else if constexpr (TypeTraits::isSequence<ValueT>) {
+        using ElementType = typename ValueT::value_type;
+        if (!frame.started) {
+            if constexpr (TypeTraits::isFixedSequence<ValueT>) {
+                frame.counter = TypeTraits::fixedLength<ValueT>;
+            } else if (!scanner.readHeader(sizeof(BinaryEncoding::LengthType), frame.counter)) {
+                return false;
+            }
+            frame.started = true;
+        }
+        if constexpr (BinaryEncoding::isFixedSize<ElementType>()) {
+            scanner.skipping = frame.counter * BinaryEncoding::fixedSize<ElementType>();
+            scanner.frames.pop_back();
+        } else if (frame.counter == 0) {
+            scanner.frames.pop_back();
+        } else {
+            --frame.counter;
+            scanner.push(&step<ElementType>);
+        }
+    } else {
+        static constexpr std::size_t count = Descriptor::getDescriptorCount<ValueT>();
+        static constexpr std::array<StepFunction, count> memberSteps =
+            makeMemberSteps<ValueT>(std::make_index_sequence<count>());
+        if (frame.counter == count) {
+            scanner.frames.pop_back();
+        } else {
+            scanner.push(memberSteps[frame.counter++]);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief functions have no value
+ *
+ * @param scanner scanner to work on
+ * @return true
+ */
+template <class SerializeableT>
+bool Serialization::BinaryScanner<SerializeableT>::stepNothing(BinaryScanner& scanner)
+{
+    scanner.frames.pop_back();
+    return true;
+}
+
+/**
+ * @brief steps of all descriptors of a class, in order.
+ *
+ * @tparam ValueT any class with static descriptor
+ * @tparam Indices positions of all descriptors
+ * @return constexpr std::array<StepFunction, sizeof...(Indices)> one step per descriptor
+ */
+template <class SerializeableT>
+template <class ValueT, std::size_t... Indices>
+constexpr std::array<typename Serialization::BinaryScanner<SerializeableT>::StepFunction, sizeof...(Indices)>
+    Serialization::BinaryScanner<SerializeableT>::makeMemberSteps(std::index_sequence<Indices...>)
+{
+    return {makeMemberStep(Descriptor::getDescriptor<ValueT, Indices>())...};
+}
+
+template <class SerializeableT>
+template <class ClassT, class MemberT>
+constexpr typename Serialization::BinaryScanner<SerializeableT>::StepFunction
+    Serialization::BinaryScanner<SerializeableT>::makeMemberStep(const MemberDescriptor<ClassT, MemberT>& descriptor)
+{
+    return &step<typename MemberDescriptor<ClassT, MemberT>::ValueType>;
+}
+
+template <class SerializeableT>
+template <class ClassT, class ReturnT, class... ArgTs>
+constexpr typename Serialization::BinaryScanner<SerializeableT>::StepFunction
+    Serialization::BinaryScanner<SerializeableT>::makeMemberStep(
+        const MemberFunctionDescriptor<ClassT, ReturnT, ArgTs...>& descriptor)
+{
+    return &stepNothing;
+}
+
+/**
+ * @brief starts the walk of a nested value
+ *
+ * @param step step of the value
+ */
+template <class SerializeableT>
+void Serialization::BinaryScanner<SerializeableT>::push(const StepFunction step)
+{
+    frames.push_back(Frame{step, 0, false});
+}
+
+/**
+ * @brief collects a length, count or flag, which may be split between chunks.
+ *
+ * @param size number of bytes of the header
+ * @param value set to the decoded header once complete
+ * @return true if the header is complete
+ */
+template <class SerializeableT>
+bool Serialization::BinaryScanner<SerializeableT>::readHeader(const std::size_t size, std::size_t& value)
+{
+    while (headerSize < size) {
+        if (position == end) {
+            return false;
+        }
+        header[headerSize++] = *position++;
+    }
+    headerSize = 0;
+    value = (size == 1) ?
+        static_cast<unsigned char>(header[0]) :
+        BinaryEncoding::read<BinaryEncoding::LengthType>(header);
+    return true;
+}
+
+/**
+ * @brief records the first error
+ *
+ * @param reason what went wrong
+ * @return false, to stop scanning
+ */
+template <class SerializeableT>
+bool Serialization::BinaryScanner<SerializeableT>::fail(const DeserializationError reason)
+{
+    if (error == DeserializationError::None) {
+        error = reason;
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,131 @@
+/**
+ * @file BinaryScanner.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief finds the end of binary objects in chunked input
+ * @version 1.0
+ * @date 2020-08-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BINARYSCANNER_H__
+#define __BINARYSCANNER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializeableT>
+class BinaryScanner;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryEncoding.h"
+#include "DeserializationResult.h"
+#include "Descriptor.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "TypeTraits.h"
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief finds the end of binary objects in chunked input
+ *
+ * @details The binary format has no delimiters, so the scanner walks the
+ * descriptors like BinaryDeserializer, but only reads lengths, counts and
+ * optional flags. The walk is kept as a stack of steps, one per nested
+ * value, so it can stop at any byte and continue with the next chunk.
+ * Values of a fixed size are skipped as a whole. Used by IncrementalDeserializer.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ */
+template <class SerializeableT>
+class BinaryScanner
+{
+    static_assert(!BinaryEncoding::isFixedSize<SerializeableT>() || (BinaryEncoding::fixedSize<SerializeableT>() != 0),
+        "objects without content can not be told apart in a stream");
+
+    // delete default constructors
+    BinaryScanner(const BinaryScanner& other) = delete;
+    BinaryScanner& operator=(const BinaryScanner& other) = delete;
+public:
+    BinaryScanner();
+
+    std::size_t scan(const char* const data, const std::size_t size);
+
+    bool isStarted() const;
+    bool isComplete() const;
+    DeserializationError getError() const;
+    void reset();
+
+private:
+    /**
+     * scans as much of the value on top of the stack as the input allows,
+     * false if it needs more input
+     */
+    using StepFunction = bool (*)(BinaryScanner& scanner);
+
+    /** a value whose walk is in progress */
+    struct Frame
+    {
+        /** scans the value */
+        StepFunction step;
+        /** next member or elements left, depending on the value */
+        std::size_t counter;
+        /** whether counter was initialized */
+        bool started;
+    };
+
+    template <class ValueT>
+    static bool step(BinaryScanner& scanner);
+
+    static bool stepNothing(BinaryScanner& scanner);
+
+    template <class ValueT, std::size_t... Indices>
+    static constexpr std::array<StepFunction, sizeof...(Indices)> makeMemberSteps(std::index_sequence<Indices...>);
+
+    template <class ClassT, class MemberT>
+    static constexpr StepFunction makeMemberStep(const MemberDescriptor<ClassT, MemberT>& descriptor);
+
+    template <class ClassT, class ReturnT, class... ArgTs>
+    static constexpr StepFunction makeMemberStep(const MemberFunctionDescriptor<ClassT, ReturnT, ArgTs...>& descriptor);
+
+    void push(const StepFunction step);
+    bool readHeader(const std::size_t size, std::size_t& value);
+    bool fail(const DeserializationError reason);
+
+    /** values being walked, the innermost on top */
+    std::vector<Frame> frames;
+    /** bytes still to skip before the next step */
+    std::size_t skipping;
+    /** length, count or flag split between chunks */
+    char header[sizeof(BinaryEncoding::LengthType)];
+    /** bytes of header received */
+    std::size_t headerSize;
+    /** next byte of the current chunk */
+    const char* position;
+    /** end of the current chunk */
+    const char* end;
+    /** the first byte of the object was scanned */
+    bool started;
+    /** the last byte of the object was scanned */
+    bool complete;
+    /** first error, None while scanning succeeds */
+    DeserializationError error;
+};
+} // Serialization
+
+// template class, include src
+#include "BinaryScanner.cpp"
+#endif //__BINARYSCANNER_H__
@@ -0,0 +1,111 @@
+/**
+ * @file BufferWriter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writer into a growable buffer
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BufferWriter.h"
+#include <algorithm>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a new Buffer Writer
+ *
+ * @param capacity initial capacity in bytes
+ */
+inline Serialization::BufferWriter::BufferWriter(const std::size_t capacity) :
+    Writer(nullptr, nullptr), buffer(new char[std::max<std::size_t>(capacity, 1)])
+{
+    begin = buffer.get();
+    cursor = begin;
+    end = begin + std::max<std::size_t>(capacity, 1);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief gets the written data, not zero terminated
+ *
+ * @return const char* first byte
+ */
+inline const char* Serialization::BufferWriter::getData() const
+{
+    return begin;
+}
+
+/**
+ * @brief gets the number of bytes written since the last clear()
+ *
+ * @return std::size_t number of bytes
+ */
+inline std::size_t Serialization::BufferWriter::getSize() const
+{
+    return cursor - begin;
+}
+
+inline std::size_t Serialization::BufferWriter::getCapacity() const
+{
+    return end - begin;
+}
+
+/**
+ * @brief grows the buffer to hold at least capacity bytes.
+ *
+ * @details Use this to allocate once if the output size is known.
+ *
+ * @param capacity minimum total capacity
+ */
+inline void Serialization::BufferWriter::reserveCapacity(const std::size_t capacity)
+{
+    if (capacity <= getCapacity()) {
+        return;
+    }
+
+    const std::size_t size = getSize();
+    std::unique_ptr<char[]> grown(new char[capacity]);
+    std::memcpy(grown.get(), begin, size);
+    buffer = std::move(grown);
+    begin = buffer.get();
+    cursor = begin + size;
+    end = begin + capacity;
+}
+
+/**
+ * @brief drops the written data but keeps the memory.
+ */
+inline void Serialization::BufferWriter::clear()
+{
+    cursor = begin;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+inline void Serialization::BufferWriter::writeOverflow(const char* const data, const std::size_t size)
+{
+    reserveCapacity(std::max(getCapacity() * 2, getSize() + size));
+    std::memcpy(cursor, data, size);
+    cursor += size;
+}
+
+inline char* Serialization::BufferWriter::reserveOverflow(const std::size_t size)
+{
+    reserveCapacity(std::max(getCapacity() * 2, getSize() + size));
+    return cursor;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
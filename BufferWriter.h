@@ -0,0 +1,67 @@
+/**
+ * @file BufferWriter.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writer into a growable buffer
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BUFFERWRITER_H__
+#define __BUFFERWRITER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class BufferWriter;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstddef>
+#include <memory>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief writer into a growable buffer
+ *
+ * @details The buffer at least doubles whenever it runs full,
+ * so writing n bytes costs amortized O(n).
+ */
+class BufferWriter : public Writer
+{
+    // delete default constructors
+    BufferWriter(const BufferWriter& other) = delete;
+    BufferWriter& operator=(const BufferWriter& other) = delete;
+public:
+    explicit BufferWriter(const std::size_t capacity = 256);
+
+    const char* getData() const;
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    void reserveCapacity(const std::size_t capacity);
+    void clear();
+
+protected:
+    virtual void writeOverflow(const char* const data, const std::size_t size) override;
+    virtual char* reserveOverflow(const std::size_t size) override;
+
+private:
+    /** owned memory, begin of the window */
+    std::unique_ptr<char[]> buffer;
+};
+} // Serialization
+
+// include src
+#include "BufferWriter.cpp"
+#endif //__BUFFERWRITER_H__
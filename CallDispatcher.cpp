@@ -0,0 +1,347 @@
+/**
+ * @file CallDispatcher.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief calls described member functions from serialized requests
+ * @version 1.0
+ * @date 2020-08-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "CallDispatcher.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class SerializeableT>
+Serialization::CallDispatcher<SerializeableT>::CallDispatcher() :
+    jsonReader(), jsonWriter(), binaryReader(), binaryWriter()
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Calls the function named by a json request.
+ *
+ * @details The request is an object with the function name as its only
+ * key and an array of the arguments as value. Only whitespace may follow.
+ *
+ * @param data json request
+ * @param size number of bytes in data
+ * @param object object to call the function on
+ * @param writer receives the return value as json
+ * @return DeserializationResult error and position in the request
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::CallDispatcher<SerializeableT>::dispatchJSON(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object,
+    Writer& writer)
+{
+    constexpr std::size_t count = Descriptor::getDescriptorCount<SerializeableT>();
+
+    jsonReader.start(data, size);
+    jsonReader.skipWhitespace();
+    if (jsonReader.expect('{')) {
+        const char* name = nullptr;
+        std::size_t nameLength = 0;
+        jsonReader.skipWhitespace();
+        if (jsonReader.readKey(name, nameLength)) {
+            jsonReader.skipWhitespace();
+            if (jsonReader.expect(':')) {
+                jsonReader.skipWhitespace();
+                dispatch(jsonReader, jsonWriter, name, nameLength, object, writer, std::make_index_sequence<count>());
+            }
+        }
+    }
+    return DeserializationResult(jsonReader.error, jsonReader.position - jsonReader.begin);
+}
+
+/**
+ * @brief Calls the function named by a binary request.
+ *
+ * @details The request is the function name as a string followed by the
+ * arguments, both as BinarySerializer writes them. Nothing may follow.
+ *
+ * @param data binary request
+ * @param size number of bytes in data
+ * @param object object to call the function on
+ * @param writer receives the return value as BinarySerializer writes it
+ * @return DeserializationResult error and position in the request
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::CallDispatcher<SerializeableT>::dispatchBinary(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object,
+    Writer& writer)
+{
+    constexpr std::size_t count = Descriptor::getDescriptorCount<SerializeableT>();
+
+    binaryReader.start(data, size);
+    const char* name = nullptr;
+    std::size_t nameLength = 0;
+    if (binaryReader.readLength(nameLength) && binaryReader.take(nameLength, name)) {
+        dispatch(binaryReader, binaryWriter, name, nameLength, object, writer, std::make_index_sequence<count>());
+    }
+    return DeserializationResult(binaryReader.error, binaryReader.position - binaryReader.begin);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief finds the function with the given name and calls it.
+ *
+ * @details Resolved like keys in JSONDeserializer: the perfect hash gives
+ * the tuple index, which selects the caller from a table built at compile
+ * time. The last entry is taken for unknown names.
+ *
+ * @tparam ReaderT JSONDeserializer or BinaryDeserializer, started on the request
+ * @tparam SerializerT serializer of the same format
+ * @tparam Indices positions of all descriptors
+ * @param reader reader positioned at the arguments
+ * @param serializer writes the return value
+ * @param name name of the function, not zero terminated
+ * @param nameLength length of name
+ * @param object object to call the function on
+ * @param writer receives the return value
+ * @return true on success
+ */
+template <class SerializeableT>
+template <class ReaderT, class SerializerT, std::size_t... Indices>
+bool Serialization::CallDispatcher<SerializeableT>::dispatch(
+    ReaderT& reader,
+    SerializerT& serializer,
+    const char* const name,
+    const std::size_t nameLength,
+    SerializeableT& object,
+    Writer& writer,
+    std::index_sequence<Indices...>)
+{
+    using CallFunction = bool (CallDispatcher::*)(ReaderT&, SerializerT&, SerializeableT&, Writer&);
+    // last entry is taken for unknown names, as notFound is the descriptor count
+    static constexpr CallFunction callFunctions[] = {
+        &CallDispatcher::call<ReaderT, SerializerT, Indices>...,
+        &CallDispatcher::callUnknown<ReaderT, SerializerT>};
+
+    const std::size_t index = SerializeableT::descriptor.findDescriptor(name, nameLength);
+    return (this->*callFunctions[index])(reader, serializer, object, writer);
+}
+
+/**
+ * @brief calls the descriptor at Index.
+ *
+ * @return true on success
+ */
+template <class SerializeableT>
+template <class ReaderT, class SerializerT, std::size_t Index>
+bool Serialization::CallDispatcher<SerializeableT>::call(
+    ReaderT& reader,
+    SerializerT& serializer,
+    SerializeableT& object,
+    Writer& writer)
+{
+    return call(reader, serializer, object, writer, Descriptor::getDescriptor<SerializeableT, Index>());
+}
+
+/**
+ * @brief member variables can not be called
+ *
+ * @return false
+ */
+template <class SerializeableT>
+template <class ReaderT, class SerializerT, class MemberT>
+bool Serialization::CallDispatcher<SerializeableT>::call(
+    ReaderT& reader,
+    SerializerT& serializer,
+    SerializeableT& object,
+    Writer& writer,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return reader.fail(DeserializationError::UnknownFunction);
+}
+
+/**
+ * @brief decodes the arguments, calls the function and writes the result.
+ *
+ * @details Arguments are decoded into fresh values, references and const
+ * in the parameter types are dropped for them.
+ *
+ * @tparam ReaderT JSONDeserializer or BinaryDeserializer
+ * @tparam SerializerT serializer of the same format
+ * @tparam ReturnT return type of the function
+ * @tparam ArgTs parameter types of the function
+ * @param reader reader positioned at the arguments
+ * @param serializer writes the return value
+ * @param object object to call the function on
+ * @param writer receives the return value
+ * @param descriptor descriptor of the function
+ * @return true on success
+ */
+template <class SerializeableT>
+template <class ReaderT, class SerializerT, class ReturnT, class... ArgTs>
+bool Serialization::CallDispatcher<SerializeableT>::call(
+    ReaderT& reader,
+    SerializerT& serializer,
+    SerializeableT& object,
+    Writer& writer,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    constexpr auto indices = std::index_sequence_for<ArgTs...>();
+
+    std::tuple<std::remove_cvref_t<ArgTs>...> arguments{};
+    if (!readArguments(reader, arguments, indices)) {
+        return false;
+    }
+    invoke(serializer, object, writer, descriptor, arguments, indices);
+    return true;
+}
+
+/**
+ * @brief fails for names the class does not describe
+ *
+ * @return false
+ */
+template <class SerializeableT>
+template <class ReaderT, class SerializerT>
+bool Serialization::CallDispatcher<SerializeableT>::callUnknown(
+    ReaderT& reader,
+    SerializerT& serializer,
+    SerializeableT& object,
+    Writer& writer)
+{
+    return reader.fail(DeserializationError::UnknownFunction);
+}
+
+/**
+ * @brief calls the function with the decoded arguments.
+ *
+ * @details Each argument is forwarded as its parameter type, so by value
+ * and rvalue reference parameters take the decoded value over, reference
+ * parameters bind to it.
+ *
+ * @tparam SerializerT JSONSerializer or BinarySerializer
+ * @tparam ReturnT return type of the function
+ * @tparam ArgTs parameter types of the function
+ * @tparam ArgumentsT tuple of the decoded arguments
+ * @tparam Indices positions of the arguments
+ * @param serializer writes the return value
+ * @param object object to call the function on
+ * @param writer receives the return value
+ * @param descriptor descriptor of the function
+ * @param arguments decoded arguments
+ */
+template <class SerializeableT>
+template <class SerializerT, class ReturnT, class... ArgTs, class ArgumentsT, std::size_t... Indices>
+void Serialization::CallDispatcher<SerializeableT>::invoke(
+    SerializerT& serializer,
+    SerializeableT& object,
+    Writer& writer,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+    ArgumentsT& arguments,
+    std::index_sequence<Indices...>)
+{
+    if constexpr (std::is_void_v<ReturnT>) {
+        descriptor.call(object, std::forward<ArgTs>(std::get<Indices>(arguments))...);
+        if constexpr (std::is_same_v<JSONSerializer, SerializerT>) {
+            writer.write("null", 4);
+        }
+    } else {
+        const ReturnT result = descriptor.call(object, std::forward<ArgTs>(std::get<Indices>(arguments))...);
+        serializer.serialize(writer, result);
+    }
+}
+
+/**
+ * @brief reads the json array of arguments and the end of the request.
+ *
+ * @tparam ArgumentsT tuple of the argument values
+ * @tparam Indices positions of the arguments
+ * @param reader json reader positioned at the array
+ * @param arguments values to fill
+ * @return true on success
+ */
+template <class SerializeableT>
+template <class ArgumentsT, std::size_t... Indices>
+bool Serialization::CallDispatcher<SerializeableT>::readArguments(
+    JSONDeserializer& reader,
+    ArgumentsT& arguments,
+    std::index_sequence<Indices...>)
+{
+    if (!reader.expect('[')) {
+        return false;
+    }
+    reader.skipWhitespace();
+    if (!(readArgument<Indices>(reader, std::get<Indices>(arguments)) && ...)) {
+        return false;
+    }
+    if (!reader.expect(']')) {
+        return false;
+    }
+    reader.skipWhitespace();
+    if (!reader.expect('}')) {
+        return false;
+    }
+    reader.skipWhitespace();
+    return (reader.position == reader.end) || reader.fail(DeserializationError::TrailingCharacters);
+}
+
+/**
+ * @brief reads the binary arguments, which have to end the request.
+ *
+ * @tparam ArgumentsT tuple of the argument values
+ * @tparam Indices positions of the arguments
+ * @param reader binary reader positioned at the first argument
+ * @param arguments values to fill
+ * @return true on success
+ */
+template <class SerializeableT>
+template <class ArgumentsT, std::size_t... Indices>
+bool Serialization::CallDispatcher<SerializeableT>::readArguments(
+    BinaryDeserializer& reader,
+    ArgumentsT& arguments,
+    std::index_sequence<Indices...>)
+{
+    if (!(reader.readValue(std::get<Indices>(arguments)) && ...)) {
+        return false;
+    }
+    return (reader.position == reader.end) || reader.fail(DeserializationError::TrailingCharacters);
+}
+
+/**
+ * @brief reads an element of the json array of arguments.
+ *
+ * @tparam Index position of the argument
+ * @tparam ValueT type of the argument
+ * @param reader json reader positioned at the argument or its separator
+ * @param value value to fill
+ * @return true on success
+ */
+template <class SerializeableT>
+template <std::size_t Index, class ValueT>
+bool Serialization::CallDispatcher<SerializeableT>::readArgument(JSONDeserializer& reader, ValueT& value)
+{
+    if constexpr (Index > 0) {
+        if (!reader.expect(',')) {
+            return false;
+        }
+        reader.skipWhitespace();
+    }
+    if (!reader.readValue(value)) {
+        return false;
+    }
+    reader.skipWhitespace();
+    return true;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
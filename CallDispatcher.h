@@ -0,0 +1,152 @@
+/**
+ * @file CallDispatcher.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief calls described member functions from serialized requests
+ * @version 1.0
+ * @date 2020-08-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __CALLDISPATCHER_H__
+#define __CALLDISPATCHER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializeableT>
+class CallDispatcher;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializationResult.h"
+#include "Descriptor.h"
+#include "DeserializerBinary.h"
+#include "DeserializerJSON.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "SerializerBinary.h"
+#include "SerializerJSON.h"
+#include "Writer.h"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief calls described member functions from serialized requests
+ *
+ * @details A request names a function of the class descriptor and holds
+ * its arguments in order:
+ *
+ *     json     {"fct2": [1, "c"]}
+ *     binary   the name and the arguments as BinarySerializer writes them
+ *
+ * The name is resolved by the perfect hash of the class descriptor, the
+ * index selects the caller of that function from a table of function
+ * pointers. The arguments are decoded into a tuple on the stack and
+ * handed to MemberFunctionDescriptor::call(...) without copies, the
+ * return value is written with the serializer of the same format (json
+ * null or nothing for void functions). Only arguments that allocate by
+ * themselves, like std::string, allocate per call. Names of member
+ * variables and unknown names fail with UnknownFunction, the function is
+ * only called when the whole request was read.
+ * Holds the readers and writers, so use one instance per thread.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ */
+template <class SerializeableT>
+class CallDispatcher
+{
+    // delete default constructors
+    CallDispatcher(const CallDispatcher& other) = delete;
+    CallDispatcher& operator=(const CallDispatcher& other) = delete;
+public:
+    CallDispatcher();
+
+    DeserializationResult dispatchJSON(
+        const char* const data,
+        const std::size_t size,
+        SerializeableT& object,
+        Writer& writer);
+
+    DeserializationResult dispatchBinary(
+        const char* const data,
+        const std::size_t size,
+        SerializeableT& object,
+        Writer& writer);
+
+private:
+    template <class ReaderT, class SerializerT, std::size_t... Indices>
+    bool dispatch(
+        ReaderT& reader,
+        SerializerT& serializer,
+        const char* const name,
+        const std::size_t nameLength,
+        SerializeableT& object,
+        Writer& writer,
+        std::index_sequence<Indices...>);
+
+    template <class ReaderT, class SerializerT, std::size_t Index>
+    bool call(ReaderT& reader, SerializerT& serializer, SerializeableT& object, Writer& writer);
+
+    template <class ReaderT, class SerializerT, class MemberT>
+    bool call(
+        ReaderT& reader,
+        SerializerT& serializer,
+        SerializeableT& object,
+        Writer& writer,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class ReaderT, class SerializerT, class ReturnT, class... ArgTs>
+    bool call(
+        ReaderT& reader,
+        SerializerT& serializer,
+        SerializeableT& object,
+        Writer& writer,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class ReaderT, class SerializerT>
+    bool callUnknown(ReaderT& reader, SerializerT& serializer, SerializeableT& object, Writer& writer);
+
+    template <class SerializerT, class ReturnT, class... ArgTs, class ArgumentsT, std::size_t... Indices>
+    void invoke(
+        SerializerT& serializer,
+        SerializeableT& object,
+        Writer& writer,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+        ArgumentsT& arguments,
+        std::index_sequence<Indices...>);
+
+    template <class ArgumentsT, std::size_t... Indices>
+    bool readArguments(JSONDeserializer& reader, ArgumentsT& arguments, std::index_sequence<Indices...>);
+
+    template <class ArgumentsT, std::size_t... Indices>
+    bool readArguments(BinaryDeserializer& reader, ArgumentsT& arguments, std::index_sequence<Indices...>);
+
+    template <std::size_t Index, class ValueT>
+    bool readArgument(JSONDeserializer& reader, ValueT& value);
+
+    /** reads json requests */
+    JSONDeserializer jsonReader;
+    /** writes json results */
+    JSONSerializer jsonWriter;
+    /** reads binary requests */
+    BinaryDeserializer binaryReader;
+    /** writes binary results */
+    BinarySerializer binaryWriter;
+};
+} // Serialization
+
+// template class, include src
+#include "CallDispatcher.cpp"
+#endif //__CALLDISPATCHER_H__
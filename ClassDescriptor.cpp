@@ -12,8 +12,13 @@
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "ClassDescriptor.h"
+#include "DescriptorTuple.h"
 #include "MemberDescriptor.h"
-#include <tuple>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -23,9 +28,17 @@
 
 template <class... MemberDescriptorTs>
 constexpr Serialization::ClassDescriptor<MemberDescriptorTs...>::
-    ClassDescriptor(const char* const name, std::tuple<MemberDescriptorTs...>&& memberDescriptors) :
-    name(name), memberDescriptors(memberDescriptors)
+    ClassDescriptor(const char* const name, DescriptorTuple<MemberDescriptorTs...>&& memberDescriptors) :
+    name(name),
+    memberDescriptors(memberDescriptors),
+    names(memberDescriptors.apply([](const auto& ...descriptor) {
+        return std::array<const char*, descriptorCount>{descriptor.getName()...};
+    })),
+    nameLengths(),
+    displacements(),
+    slots()
 {
+    buildNameTable();
 }
 
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
@@ -36,8 +49,185 @@ constexpr const char* const Serialization::ClassDescriptor<MemberDescriptorTs...
     return name;
 }
 
+/**
+ * @brief finds a member or function descriptor by its name.
+ * 
+ * @param key name to look for, does not need to be zero terminated
+ * @param length length of key
+ * @return constexpr std::size_t tuple index of the descriptor, notFound if unknown
+ */
+template <class... MemberDescriptorTs>
+constexpr std::size_t Serialization::ClassDescriptor<MemberDescriptorTs...>::findDescriptor(
+    const char* const key,
+    const std::size_t length) const
+{
+    if constexpr (descriptorCount == 0) {
+        return notFound;
+    } else {
+        const std::size_t bucket = hash(key, length, 0) % bucketCount;
+        const std::size_t slot = hash(key, length, displacements[bucket]) & (slotCount - 1);
+        const std::size_t index = slots[slot];
+        if ((index != notFound) && (nameLengths[index] == length) && isEqual(names[index], key, length)) {
+            return index;
+        }
+        return notFound;
+    }
+}
+
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
+/**
+ * @brief builds the perfect hash table over all names.
+ * 
+ * @details Names are distributed to buckets by a first hash and sorted
+ * by bucket, so every step only looks at the names of one bucket.
+ * Starting with the largest bucket, each bucket gets the first
+ * displacement that places all of its names into free slots with a
+ * second hash. Runs at compile time, as descriptors are constexpr.
+ */
+template <class... MemberDescriptorTs>
+constexpr void Serialization::ClassDescriptor<MemberDescriptorTs...>::buildNameTable()
+{
+    for (std::size_t ii = 0; ii < descriptorCount; ++ii) {
+        std::size_t length = 0;
+        while (names[ii][length] != '\0') {
+            ++length;
+        }
+        nameLengths[ii] = length;
+    }
+    for (std::size_t& slot : slots) {
+        slot = notFound;
+    }
+
+    // count the names per bucket, then sort them by bucket
+    std::array<std::size_t, descriptorCount> buckets{};
+    std::array<std::size_t, bucketCount + 1> bucketStarts{};
+    for (std::size_t ii = 0; ii < descriptorCount; ++ii) {
+        buckets[ii] = hash(names[ii], nameLengths[ii], 0) % bucketCount;
+        ++bucketStarts[buckets[ii] + 1];
+    }
+    std::size_t largestBucket = 0;
+    for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+        largestBucket = std::max(largestBucket, bucketStarts[bucket + 1]);
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+    }
+    std::array<std::size_t, descriptorCount> order{};
+    std::array<std::size_t, bucketCount + 1> bucketEnds = bucketStarts;
+    for (std::size_t ii = 0; ii < descriptorCount; ++ii) {
+        order[bucketEnds[buckets[ii]]++] = ii;
+    }
+
+    // equal names always share a bucket and can never be told apart
+    for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+        for (std::size_t ii = bucketStarts[bucket]; ii < bucketStarts[bucket + 1]; ++ii) {
+            for (std::size_t jj = ii + 1; jj < bucketStarts[bucket + 1]; ++jj) {
+                const std::size_t first = order[ii];
+                const std::size_t second = order[jj];
+                if ((nameLengths[first] == nameLengths[second]) &&
+                    isEqual(names[first], names[second], nameLengths[first])) {
+                    namesCanNotBeHashed();
+                }
+            }
+        }
+    }
+
+    for (std::size_t size = largestBucket; size > 0; --size) {
+        for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+            if ((bucketStarts[bucket + 1] - bucketStarts[bucket]) != size) {
+                continue;
+            }
+            std::uint32_t displacement = 1;
+            while (!placeBucket(order, bucketStarts[bucket], bucketStarts[bucket + 1], displacement)) {
+                if (++displacement == maxDisplacement) {
+                    namesCanNotBeHashed();
+                }
+            }
+            displacements[bucket] = displacement;
+        }
+    }
+}
+
+/**
+ * @brief tries to place all names of a bucket with one displacement.
+ * 
+ * @param order descriptor indices sorted by bucket
+ * @param begin first position of the bucket in order
+ * @param end position behind the bucket in order
+ * @param displacement seed of the second hash
+ * @return true if all names got a free slot, slots are only taken then
+ */
+template <class... MemberDescriptorTs>
+constexpr bool Serialization::ClassDescriptor<MemberDescriptorTs...>::placeBucket(
+    const std::array<std::size_t, descriptorCount>& order,
+    const std::size_t begin,
+    const std::size_t end,
+    const std::uint32_t displacement)
+{
+    for (std::size_t ii = begin; ii < end; ++ii) {
+        const std::size_t index = order[ii];
+        const std::size_t slot = hash(names[index], nameLengths[index], displacement) & (slotCount - 1);
+        if (slots[slot] != notFound) {
+            // taken by another bucket or this one, undo
+            for (std::size_t jj = begin; jj < ii; ++jj) {
+                const std::size_t placed = order[jj];
+                slots[hash(names[placed], nameLengths[placed], displacement) & (slotCount - 1)] = notFound;
+            }
+            return false;
+        }
+        slots[slot] = index;
+    }
+    return true;
+}
+
+/**
+ * @brief seeded FNV-1a hash with a final mix
+ * 
+ * @param key characters to hash
+ * @param length number of characters
+ * @param seed seed, 0 for the bucket, displacement for the slot
+ * @return constexpr std::uint32_t hash value
+ */
+template <class... MemberDescriptorTs>
+constexpr std::uint32_t Serialization::ClassDescriptor<MemberDescriptorTs...>::hash(
+    const char* const key,
+    const std::size_t length,
+    const std::uint32_t seed)
+{
+    std::uint32_t value = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (std::size_t ii = 0; ii < length; ++ii) {
+        value = (value ^ static_cast<unsigned char>(key[ii])) * 16777619u;
+    }
+    value ^= value >> 16;
+    value *= 0x85EBCA6Bu;
+    value ^= value >> 13;
+    return value;
+}
+
+template <class... MemberDescriptorTs>
+constexpr bool Serialization::ClassDescriptor<MemberDescriptorTs...>::isEqual(
+    const char* const first,
+    const char* const second,
+    const std::size_t length)
+{
+    for (std::size_t ii = 0; ii < length; ++ii) {
+        if (first[ii] != second[ii]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief not constexpr on purpose: calling it while building a
+ * descriptor at compile time is a compile error.
+ * 
+ * @details reached if two members or functions share a name.
+ */
+template <class... MemberDescriptorTs>
+void Serialization::ClassDescriptor<MemberDescriptorTs...>::namesCanNotBeHashed()
+{
+}
+
 //---------------------------- STATIC FUNCTIONS -------------------------------
\ No newline at end of file
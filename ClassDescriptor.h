@@ -22,7 +22,11 @@ class ClassDescriptor;
 
 //--------------------------------- INCLUDES ----------------------------------
 
-#include <tuple>
+#include "DescriptorTuple.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 
 namespace Serialization
 {
@@ -32,6 +36,10 @@ namespace Serialization
 
 /**
  * @brief describes a class for serialization
+ * 
+ * @details Builds a perfect hash table over the names of all descriptors
+ * at compile time (hash and displace), so findDescriptor(...) resolves a
+ * name to its tuple index in O(1). Duplicate names fail to compile.
  */
 template<class... MemberDescriptorTs>
 class ClassDescriptor
@@ -46,13 +54,47 @@ class ClassDescriptor
 
     constexpr const char* const getName() const;
 
+public:
+    /** number of member and function descriptors */
+    static constexpr std::size_t descriptorCount = sizeof...(MemberDescriptorTs);
+    /** returned by findDescriptor(...) for unknown names */
+    static constexpr std::size_t notFound = descriptorCount;
+
+    constexpr std::size_t findDescriptor(const char* const key, const std::size_t length) const;
+
 private:
-    constexpr ClassDescriptor(const char* const name, std::tuple<MemberDescriptorTs...>&& memberDescriptorArgs);
+    /** first level of the hash, each bucket has its own displacement */
+    static constexpr std::size_t bucketCount = descriptorCount / 2 + 1;
+    /** second level of the hash, power of two with at least twice the names */
+    static constexpr std::size_t slotCount = std::bit_ceil(2 * descriptorCount);
+    /** attempts to find a displacement before giving up */
+    static constexpr std::uint32_t maxDisplacement = 1 << 16;
+
+    constexpr ClassDescriptor(const char* const name, DescriptorTuple<MemberDescriptorTs...>&& memberDescriptorArgs);
+
+    constexpr void buildNameTable();
+    constexpr bool placeBucket(
+        const std::array<std::size_t, descriptorCount>& order,
+        const std::size_t begin,
+        const std::size_t end,
+        const std::uint32_t displacement);
+
+    static constexpr std::uint32_t hash(const char* const key, const std::size_t length, const std::uint32_t seed);
+    static constexpr bool isEqual(const char* const first, const char* const second, const std::size_t length);
+    static void namesCanNotBeHashed();
 
     /** class name */
     const char* const name;
     /** descriptors for the member variables */
-    const std::tuple<MemberDescriptorTs...> memberDescriptors;
+    const DescriptorTuple<MemberDescriptorTs...> memberDescriptors;
+    /** name of each descriptor */
+    std::array<const char*, descriptorCount> names;
+    /** length of each name */
+    std::array<std::size_t, descriptorCount> nameLengths;
+    /** seed of the second hash for each bucket */
+    std::array<std::uint32_t, bucketCount> displacements;
+    /** descriptor index for each slot, notFound if empty */
+    std::array<std::size_t, slotCount> slots;
 };
 } // Serialization
 
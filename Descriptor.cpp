@@ -13,7 +13,10 @@
 
 #include "Descriptor.h"
 #include "MemberDescriptor.h"
-#include <tuple>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -23,55 +26,325 @@
 
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
 
+/**
+ * @brief makes the descriptor of a class from its members and functions.
+ *
+ * @details Takes member pointer name pairs, optionally followed by an id,
+ * and function pointers with name and argument names. All descriptors
+ * are made in one pack expansion, so compile time grows linear with
+ * the number of members.
+ *
+ * @tparam MemberDescriptorArgTs types of the arguments
+ * @param name class name
+ * @param memberDescriptorArgs arguments of all descriptors, in order
+ * @return constexpr auto ClassDescriptor
+ */
 template <class... MemberDescriptorArgTs>
 constexpr auto Serialization::Descriptor::makeClassDescriptor(
     const char* const name,
     MemberDescriptorArgTs&&... memberDescriptorArgs
 )
 {
-    return ClassDescriptor(name, make(std::forward<MemberDescriptorArgTs>(memberDescriptorArgs)...));
+    MakeArguments<std::index_sequence_for<MemberDescriptorArgTs...>, MemberDescriptorArgTs&&...> arguments{
+        {std::forward<MemberDescriptorArgTs>(memberDescriptorArgs)}...
+    };
+    return ClassDescriptor(
+        name,
+        makeDescriptors(arguments, std::make_index_sequence<countDescriptors<MemberDescriptorArgTs...>()>())
+    );
+}
+
+/**
+ * @brief gets the number of descriptors (members and functions) of a class.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @return constexpr std::size_t number of descriptors
+ */
+template <class SerializeableT>
+constexpr std::size_t Serialization::Descriptor::getDescriptorCount()
+{
+    return SerializeableT::descriptor.descriptorCount;
 }
 
 /**
- * @brief Makes a tuple of descriptors.
+ * @brief gets a member or member function descriptor by its position.
  * 
- * @details creates a tuple of descriptors for any member pointer
- * name pair it gets passed. Automatically determines the right type
- * of descriptor.
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position in makeClassDescriptor(...)
+ * @return constexpr const auto& descriptor
+ */
+template <class SerializeableT, std::size_t Index>
+constexpr const auto& Serialization::Descriptor::getDescriptor()
+{
+    return SerializeableT::descriptor.memberDescriptors.template get<Index>();
+}
+
+/**
+ * @brief gets the class name as compile time string.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @return constexpr auto FixedString of the name
+ */
+template <class SerializeableT>
+constexpr auto Serialization::Descriptor::getClassName()
+{
+    constexpr const char* name = SerializeableT::descriptor.getName();
+    return FixedString<getLength(name)>(name);
+}
+
+/**
+ * @brief gets the name of a member or function as compile time string.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position in makeClassDescriptor(...)
+ * @return constexpr auto FixedString of the name
+ */
+template <class SerializeableT, std::size_t Index>
+constexpr auto Serialization::Descriptor::getDescriptorName()
+{
+    constexpr const char* name = getDescriptor<SerializeableT, Index>().getName();
+    return FixedString<getLength(name)>(name);
+}
+
+/**
+ * @brief gets the name of a function argument as compile time string.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position of the function in makeClassDescriptor(...)
+ * @tparam ArgumentIndex position of the argument
+ * @return constexpr auto FixedString of the name
+ */
+template <class SerializeableT, std::size_t Index, std::size_t ArgumentIndex>
+constexpr auto Serialization::Descriptor::getArgumentName()
+{
+    constexpr const char* name = getDescriptor<SerializeableT, Index>().getArgumentName(ArgumentIndex);
+    return FixedString<getLength(name)>(name);
+}
+
+/**
+ * @brief checks if no member descriptor is placed before Index.
+ * 
+ * @details used to decide at compile time whether a seperator is needed.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position in makeClassDescriptor(...)
+ * @return true if no member is described before Index
+ */
+template <class SerializeableT, std::size_t Index>
+constexpr bool Serialization::Descriptor::isFirstMember()
+{
+    return countMembers<SerializeableT>(std::make_index_sequence<Index>()) == 0;
+}
+
+/**
+ * @brief gets the number of member variables of a class, without functions.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @return constexpr std::size_t number of member descriptors
+ */
+template <class SerializeableT>
+constexpr std::size_t Serialization::Descriptor::getMemberCount()
+{
+    return countMembers<SerializeableT>(std::make_index_sequence<getDescriptorCount<SerializeableT>()>());
+}
+
+/**
+ * @brief gets the position of a member among the member variables only.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position in makeClassDescriptor(...)
+ * @return constexpr std::size_t number of members described before Index
+ */
+template <class SerializeableT, std::size_t Index>
+constexpr std::size_t Serialization::Descriptor::getMemberPosition()
+{
+    return countMembers<SerializeableT>(std::make_index_sequence<Index>());
+}
+
+/**
+ * @brief checks if no function descriptor is placed before Index.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position in makeClassDescriptor(...)
+ * @return true if no function is described before Index
+ */
+template <class SerializeableT, std::size_t Index>
+constexpr bool Serialization::Descriptor::isFirstFunction()
+{
+    return countMembers<SerializeableT>(std::make_index_sequence<Index>()) == Index;
+}
+
+/**
+ * @brief checks if the member descriptors cover every byte of a class.
+ * 
+ * @details True for trivial standard layout classes, whose members are
+ * all described, in declaration order and without padding in between.
+ * The memory of such an object is exactly its members in descriptor order.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @return true if the descriptors cover the object
+ */
+template <class SerializeableT>
+constexpr bool Serialization::Descriptor::isDenselyDescribed()
+{
+    if constexpr (std::is_trivially_copyable_v<SerializeableT> &&
+        std::is_trivially_default_constructible_v<SerializeableT> &&
+        std::is_standard_layout_v<SerializeableT>) {
+        return isDenselyDescribed<SerializeableT>(std::make_index_sequence<getDescriptorCount<SerializeableT>()>());
+    } else {
+        return false;
+    }
+}
+
+/**
+ * @brief constexpr strlen
+ * 
+ * @param string zero terminated string
+ * @return constexpr std::size_t number of characters
+ */
+constexpr std::size_t Serialization::Descriptor::getLength(const char* const string)
+{
+    std::size_t length = 0;
+    while (string[length] != '\0') {
+        ++length;
+    }
+    return length;
+}
+
+/**
+ * @brief gets one argument of makeClassDescriptor(...) by its position.
+ *
+ * @tparam Position position of the argument
+ * @tparam ArgT reference type of the argument
+ * @param argument deduced as base of MakeArguments
+ * @return constexpr ArgT&& the argument, forwarded
+ */
+template <std::size_t Position, class ArgT>
+constexpr ArgT&& Serialization::Descriptor::getMakeArgument(MakeArgument<Position, ArgT>& argument)
+{
+    return std::forward<ArgT>(argument.value);
+}
+
+/**
+ * @brief counts the descriptors the arguments of makeClassDescriptor(...) describe.
+ *
+ * @tparam ArgTs types of the arguments
+ * @return constexpr std::size_t number of descriptors
+ */
+template <class... ArgTs>
+constexpr std::size_t Serialization::Descriptor::countDescriptors()
+{
+    return getDescriptorStarts<ArgTs...>().second;
+}
+
+/**
+ * @brief finds the first argument of every descriptor.
+ *
+ * @details A descriptor takes three arguments if it is a function or its
+ * name is followed by an integer id, two otherwise. The start behind the
+ * last descriptor is the number of arguments.
+ *
+ * @tparam ArgTs types of the arguments of makeClassDescriptor(...)
+ * @return constexpr auto pair of the starts and the number of descriptors
+ */
+template <class... ArgTs>
+constexpr auto Serialization::Descriptor::getDescriptorStarts()
+{
+    constexpr std::size_t argumentCount = sizeof...(ArgTs);
+    constexpr std::array<bool, argumentCount + 1> isFunction = {
+        std::is_member_function_pointer_v<std::remove_cvref_t<ArgTs>>..., false
+    };
+    constexpr std::array<bool, argumentCount + 1> isId = {std::is_integral_v<std::remove_cvref_t<ArgTs>>..., false};
+
+    std::array<std::size_t, argumentCount / 2 + 2> starts{};
+    std::size_t count = 0;
+    std::size_t start = 0;
+    while (start < argumentCount) {
+        starts[count++] = start;
+        const bool hasThird = isFunction[start] || ((start + 2 < argumentCount) && isId[start + 2]);
+        start += hasThird ? 3 : 2;
+    }
+    starts[count] = argumentCount;
+    return std::make_pair(starts, count);
+}
+
+/**
+ * @brief makes the tuple of all descriptors in one pack expansion.
+ *
+ * @tparam ArgTs types of the arguments of makeClassDescriptor(...)
+ * @tparam Positions positions of the arguments
+ * @tparam Indices positions of the descriptors
+ * @param arguments arguments of makeClassDescriptor(...)
+ * @return constexpr auto DescriptorTuple of all descriptors
+ */
+template <class... ArgTs, std::size_t... Positions, std::size_t... Indices>
+constexpr auto Serialization::Descriptor::makeDescriptors(
+    MakeArguments<std::index_sequence<Positions...>, ArgTs...>& arguments,
+    std::index_sequence<Indices...>)
+{
+    constexpr auto starts = getDescriptorStarts<ArgTs...>().first;
+    return DescriptorTuple(makeDescriptor<starts[Indices], starts[Indices + 1] - starts[Indices]>(arguments)...);
+}
+
+/**
+ * @brief makes one descriptor from its arguments.
+ *
+ * @tparam Start position of the first argument
+ * @tparam Count number of arguments, 2 or 3
+ * @tparam ArgumentsT MakeArguments
+ * @param arguments arguments of makeClassDescriptor(...)
+ * @return constexpr auto MemberDescriptor or MemberFunctionDescriptor
+ */
+template <std::size_t Start, std::size_t Count, class ArgumentsT>
+constexpr auto Serialization::Descriptor::makeDescriptor(ArgumentsT& arguments)
+{
+    if constexpr (Count == 3) {
+        return make(
+            getMakeArgument<Start>(arguments),
+            getMakeArgument<Start + 1>(arguments),
+            getMakeArgument<Start + 2>(arguments)
+        );
+    } else {
+        return make(getMakeArgument<Start>(arguments), getMakeArgument<Start + 1>(arguments));
+    }
+}
+
+/**
+ * @brief makes the descriptor of a member.
  * 
- * @tparam SerializeableT class that the descriptors are created for
+ * @tparam SerializeableT class that the descriptor is created for
  * @tparam MemberT member type that the descriptor is created for
  * @param member member that the descriptor is created for
  * @param name name of the member shown to Serializers
- * @return constexpr auto tuple of descriptors
+ * @return constexpr auto MemberDescriptor
  */
 template<class SerializeableT, class MemberT,
-    typename std::enable_if_t<std::is_object_v<MemberT>, int> = 0>
+    typename std::enable_if_t<std::is_object_v<MemberT>, int>>
 constexpr auto Serialization::Descriptor::make(MemberT SerializeableT::*member, const char* const name)
 {
-    return std::make_tuple(MemberDescriptor(member, name));
+    return MemberDescriptor(member, name);
 }
 
 /**
- * @brief Makes a tuple of descriptors.
- * 
- * @details creates a tuple of descriptors for any member pointer
- * name pair it gets passed. Automatically determines the right type
- * of descriptor.
- * 
- * @tparam SerializeableT class that the descriptors are created for
+ * @brief makes the descriptor of a member with an id.
+ *
+ * @details An integer behind the name of a member is its id, a number
+ * that stays the same when members are added or removed. Formats that
+ * identify members by number (TaggedSerializer) need one for every member.
+ *
+ * @tparam SerializeableT class that the descriptor is created for
  * @tparam MemberT member type that the descriptor is created for
- * @tparam LeftArgsT type of leftover arguments used to create more descriptors
+ * @tparam IdT any integer type
  * @param member member that the descriptor is created for
  * @param name name of the member shown to Serializers
- * @param leftArgs arguements to create next descriptors from
- * @return constexpr auto tuple of descriptors
+ * @param id stable number of the member, above 0
+ * @return constexpr auto MemberDescriptor
  */
-template<class SerializeableT, class MemberT, class... LeftArgTs,
-    typename std::enable_if_t<std::is_object_v<MemberT>, int> = 0>
-constexpr auto Serialization::Descriptor::make(MemberT SerializeableT::*member, const char* const name, LeftArgTs&&... leftArgs)
+template<class SerializeableT, class MemberT, class IdT,
+    typename std::enable_if_t<std::is_object_v<MemberT> && std::is_integral_v<IdT>, int>>
+constexpr auto Serialization::Descriptor::make(MemberT SerializeableT::*member, const char* const name, const IdT id)
 {
-    return std::tuple_cat(std::make_tuple(MemberDescriptor(member, name)), make(std::forward<LeftArgTs>(leftArgs)...));
+    return MemberDescriptor(member, name, static_cast<std::uint32_t>(id));
 }
 
 template <class SerializeableT, class ReturnT, class... ArgTs>
@@ -80,28 +353,99 @@ constexpr auto Serialization::Descriptor::make(
     const char* const name,
     const std::array<const char* const, sizeof...(ArgTs)>&& argumentNames)
 {
-    return std::make_tuple(
-        MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>(function, name, std::move(argumentNames))
-    );
-}
-
-template <class SerializeableT, class ReturnT, class... ArgTs, class... LeftArgTs>
-constexpr auto Serialization::Descriptor::make(
-    ReturnT (SerializeableT::*function)(ArgTs...),
-    const char* const name,
-    const std::array<const char* const, sizeof...(ArgTs)>&& argumentNames,
-    LeftArgTs&&... leftArgs)
-{
-    return std::tuple_cat(
-        std::make_tuple(
-            MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>(function, name, std::move(argumentNames))
-        ),
-        make(std::forward<LeftArgTs>(leftArgs)...)
-    );
+    return MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>(function, name, std::move(argumentNames));
 }
 
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
+/**
+ * @brief checks order and total size of the described members.
+ * 
+ * @details Member addresses can only be compared within one object,
+ * so a value initialized object is created at compile time.
+ * 
+ * @tparam SerializeableT trivial standard layout class
+ * @tparam Indices positions of all descriptors
+ * @return true if the members follow each other and add up to the object
+ */
+template <class SerializeableT, std::size_t... Indices>
+constexpr bool Serialization::Descriptor::isDenselyDescribed(std::index_sequence<Indices...>)
+{
+    const SerializeableT object{};
+    const void* previous = nullptr;
+    std::size_t size = 0;
+    const bool ordered = (true && ... && isBehind(object, getDescriptor<SerializeableT, Indices>(), previous, size));
+    return ordered && (size == sizeof(SerializeableT));
+}
+
+/**
+ * @brief checks that a member is placed behind the previous one.
+ * 
+ * @tparam SerializeableT 
+ * @tparam MemberT 
+ * @param object object to take the member address from
+ * @param descriptor descriptor of the member
+ * @param previous address of the previous member, nullptr for the first, updated
+ * @param size summed size of the members so far, updated
+ * @return true if the member is behind the previous one
+ */
+template <class SerializeableT, class MemberT>
+constexpr bool Serialization::Descriptor::isBehind(
+    const SerializeableT& object,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+    const void*& previous,
+    std::size_t& size)
+{
+    const void* const address = &(object.*descriptor.getMember());
+    if ((previous != nullptr) && !(previous < address)) {
+        return false;
+    }
+    previous = address;
+    size += sizeof(MemberT);
+    return true;
+}
+
+/**
+ * @brief functions take no space in the object
+ * 
+ * @return true
+ */
+template <class SerializeableT, class ReturnT, class... ArgTs>
+constexpr bool Serialization::Descriptor::isBehind(
+    const SerializeableT& object,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+    const void*& previous,
+    std::size_t& size)
+{
+    return true;
+}
+
+/**
+ * @brief counts the member descriptors at the given positions.
+ * 
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Indices positions to check
+ * @return constexpr std::size_t number of member descriptors
+ */
+template <class SerializeableT, std::size_t... Indices>
+constexpr std::size_t Serialization::Descriptor::countMembers(std::index_sequence<Indices...>)
+{
+    return (std::size_t(0) + ... + (isMember(getDescriptor<SerializeableT, Indices>()) ? 1 : 0));
+}
+
+template <class SerializeableT, class MemberT>
+constexpr bool Serialization::Descriptor::isMember(const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return true;
+}
+
+template <class SerializeableT, class ReturnT, class... ArgTs>
+constexpr bool Serialization::Descriptor::isMember(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return false;
+}
+
 //---------------------------- STATIC FUNCTIONS -------------------------------
\ No newline at end of file
@@ -22,9 +22,14 @@ class Descriptor;
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "ClassDescriptor.h"
+#include "DescriptorTuple.h"
+#include "FixedString.h"
+#include "MemberDescriptor.h"
 #include "MemberFunctionDescriptor.h"
 #include <array>
-#include <tuple>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace Serialization
 {
@@ -47,27 +52,120 @@ public:
         const char* const name,
         MemberDescriptorArgTs&&... memberDescriptorArgs
     );
+
+    template <class SerializeableT>
+    constexpr static std::size_t getDescriptorCount();
+
+    template <class SerializeableT, std::size_t Index>
+    constexpr static const auto& getDescriptor();
+
+    template <class SerializeableT>
+    constexpr static auto getClassName();
+
+    template <class SerializeableT, std::size_t Index>
+    constexpr static auto getDescriptorName();
+
+    template <class SerializeableT, std::size_t Index, std::size_t ArgumentIndex>
+    constexpr static auto getArgumentName();
+
+    template <class SerializeableT, std::size_t Index>
+    constexpr static bool isFirstMember();
+
+    template <class SerializeableT>
+    constexpr static std::size_t getMemberCount();
+
+    template <class SerializeableT, std::size_t Index>
+    constexpr static std::size_t getMemberPosition();
+
+    template <class SerializeableT, std::size_t Index>
+    constexpr static bool isFirstFunction();
+
+    template <class SerializeableT>
+    constexpr static bool isDenselyDescribed();
+
+    constexpr static std::size_t getLength(const char* const string);
+
 private:
+    template <class SerializeableT, std::size_t... Indices>
+    constexpr static std::size_t countMembers(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, std::size_t... Indices>
+    constexpr static bool isDenselyDescribed(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    constexpr static bool isBehind(
+        const SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+        const void*& previous,
+        std::size_t& size);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    constexpr static bool isBehind(
+        const SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+        const void*& previous,
+        std::size_t& size);
+
+    template <class SerializeableT, class MemberT>
+    constexpr static bool isMember(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    constexpr static bool isMember(const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    /**
+     * @brief one argument of makeClassDescriptor(...), tagged with its position
+     */
+    template <std::size_t Position, class ArgT>
+    struct MakeArgument
+    {
+        ArgT value;
+    };
+
+    /**
+     * @brief all arguments of makeClassDescriptor(...) as flat aggregate
+     *
+     * @details Inherits one MakeArgument per position instead of nesting
+     * like std::tuple, so any argument is found by overload resolution
+     * without recursion.
+     */
+    template <class PositionsT, class... ArgTs>
+    struct MakeArguments;
+
+    template <std::size_t... Positions, class... ArgTs>
+    struct MakeArguments<std::index_sequence<Positions...>, ArgTs...> : MakeArgument<Positions, ArgTs>...
+    {
+    };
+
+    template <std::size_t Position, class ArgT>
+    constexpr static ArgT&& getMakeArgument(MakeArgument<Position, ArgT>& argument);
+
+    template <class... ArgTs>
+    constexpr static std::size_t countDescriptors();
+
+    template <class... ArgTs>
+    constexpr static auto getDescriptorStarts();
+
+    template <class... ArgTs, std::size_t... Positions, std::size_t... Indices>
+    constexpr static auto makeDescriptors(
+        MakeArguments<std::index_sequence<Positions...>, ArgTs...>& arguments,
+        std::index_sequence<Indices...>);
+
+    template <std::size_t Start, std::size_t Count, class ArgumentsT>
+    constexpr static auto makeDescriptor(ArgumentsT& arguments);
+
     template<class SerializeableT, class MemberT,
         typename std::enable_if_t<std::is_object_v<MemberT>, int> = 0>
     constexpr static auto make(MemberT SerializeableT::*member, const char* const name);
 
-    template<class SerializeableT, class MemberT, class... LeftArgTs,
-        typename std::enable_if_t<std::is_object_v<MemberT>, int> = 0>
-    constexpr static auto make(MemberT SerializeableT::*member, const char* const name, LeftArgTs&&... leftArgs);
+    template<class SerializeableT, class MemberT, class IdT,
+        typename std::enable_if_t<std::is_object_v<MemberT> && std::is_integral_v<IdT>, int> = 0>
+    constexpr static auto make(MemberT SerializeableT::*member, const char* const name, const IdT id);
 
     template <class SerializeableT, class ReturnT, class... ArgTs>
     constexpr static auto make(
         ReturnT (SerializeableT::*function)(ArgTs...),
         const char* const name,
         const std::array<const char* const, sizeof...(ArgTs)>&& argumentNames);
-
-    template <class SerializeableT, class ReturnT, class... ArgTs, class... LeftArgTs>
-    constexpr static auto make(
-        ReturnT (SerializeableT::*function)(ArgTs...),
-        const char* const name,
-        const std::array<const char* const, sizeof...(ArgTs)>&& argumentNames,
-        LeftArgTs&&... leftArgs);
 };
 } // Serialization
 
@@ -0,0 +1,90 @@
+/**
+ * @file DescriptorTuple.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief flat tuple holding the descriptors of a class
+ * @version 1.0
+ * @date 2020-09-03
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DescriptorTuple.h"
+#include <cstddef>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class... DescriptorTs>
+constexpr Serialization::DescriptorTuple<DescriptorTs...>::DescriptorTuple(const DescriptorTs&... descriptors) :
+    DescriptorTupleElements<std::index_sequence_for<DescriptorTs...>, DescriptorTs...>{{descriptors}...}
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief gets a descriptor by its position.
+ *
+ * @tparam Index position of the descriptor
+ * @return constexpr const auto& descriptor
+ */
+template <class... DescriptorTs>
+template <std::size_t Index>
+constexpr const auto& Serialization::DescriptorTuple<DescriptorTs...>::get() const
+{
+    return getElement<Index>(*this);
+}
+
+/**
+ * @brief calls a function with all descriptors as arguments, like std::apply.
+ *
+ * @tparam FunctionT callable taking every descriptor
+ * @param function function to call
+ * @return constexpr decltype(auto) result of the function
+ */
+template <class... DescriptorTs>
+template <class FunctionT>
+constexpr decltype(auto) Serialization::DescriptorTuple<DescriptorTs...>::apply(FunctionT&& function) const
+{
+    return apply(std::forward<FunctionT>(function), std::index_sequence_for<DescriptorTs...>());
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief deduces the descriptor type from the element at Index.
+ *
+ * @tparam Index position of the descriptor
+ * @tparam DescriptorT deduced descriptor type
+ * @param element base of the tuple at Index
+ * @return constexpr const DescriptorT& descriptor
+ */
+template <class... DescriptorTs>
+template <std::size_t Index, class DescriptorT>
+constexpr const DescriptorT& Serialization::DescriptorTuple<DescriptorTs...>::getElement(
+    const DescriptorTupleElement<Index, DescriptorT>& element)
+{
+    return element.descriptor;
+}
+
+template <class... DescriptorTs>
+template <class FunctionT, std::size_t... Indices>
+constexpr decltype(auto) Serialization::DescriptorTuple<DescriptorTs...>::apply(
+    FunctionT&& function,
+    std::index_sequence<Indices...>) const
+{
+    return std::forward<FunctionT>(function)(
+        static_cast<const DescriptorTupleElement<Indices, DescriptorTs>&>(*this).descriptor...
+    );
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
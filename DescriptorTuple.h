@@ -0,0 +1,91 @@
+/**
+ * @file DescriptorTuple.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief flat tuple holding the descriptors of a class
+ * @version 1.0
+ * @date 2020-09-03
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __DESCRIPTORTUPLE_H__
+#define __DESCRIPTORTUPLE_H__
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+#include <utility>
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class... DescriptorTs>
+class DescriptorTuple;
+}
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/**
+ * @brief one descriptor of a DescriptorTuple, tagged with its position
+ */
+template <std::size_t Index, class DescriptorT>
+struct DescriptorTupleElement
+{
+    DescriptorT descriptor;
+};
+
+template <class IndicesT, class... DescriptorTs>
+struct DescriptorTupleElements;
+
+template <std::size_t... Indices, class... DescriptorTs>
+struct DescriptorTupleElements<std::index_sequence<Indices...>, DescriptorTs...> :
+    DescriptorTupleElement<Indices, DescriptorTs>...
+{
+};
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief flat tuple holding the descriptors of a class
+ *
+ * @details Inherits every descriptor side by side instead of nesting one
+ * level per element like std::tuple, whose construction takes minutes
+ * and exceeds the template depth for classes with hundreds of members.
+ * get<Index>() finds the element by overload resolution, apply(...)
+ * expands all of them at once.
+ *
+ * @tparam DescriptorTs MemberDescriptor and MemberFunctionDescriptor types
+ */
+template <class... DescriptorTs>
+class DescriptorTuple : DescriptorTupleElements<std::index_sequence_for<DescriptorTs...>, DescriptorTs...>
+{
+public:
+    /** number of descriptors */
+    static constexpr std::size_t size = sizeof...(DescriptorTs);
+
+    constexpr DescriptorTuple(const DescriptorTs&... descriptors);
+
+    template <std::size_t Index>
+    constexpr const auto& get() const;
+
+    template <class FunctionT>
+    constexpr decltype(auto) apply(FunctionT&& function) const;
+
+private:
+    template <std::size_t Index, class DescriptorT>
+    static constexpr const DescriptorT& getElement(const DescriptorTupleElement<Index, DescriptorT>& element);
+
+    template <class FunctionT, std::size_t... Indices>
+    constexpr decltype(auto) apply(FunctionT&& function, std::index_sequence<Indices...>) const;
+};
+} // Serialization
+
+// template class, include src
+#include "DescriptorTuple.cpp"
+#endif //__DESCRIPTORTUPLE_H__
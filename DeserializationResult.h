@@ -0,0 +1,117 @@
+/**
+ * @file DeserializationResult.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief outcome of a deserialization
+ * @version 1.0
+ * @date 2020-08-03
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __DESERIALIZATIONRESULT_H__
+#define __DESERIALIZATIONRESULT_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+enum class DeserializationError;
+class DeserializationResult;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+/**
+ * @brief reasons a deserialization can fail
+ */
+enum class DeserializationError
+{
+    None,
+    UnexpectedEnd,
+    UnexpectedCharacter,
+    InvalidNumber,
+    NumberOutOfRange,
+    InvalidString,
+    TypeMismatch,
+    UnsupportedType,
+    TooDeep,
+    TrailingCharacters,
+    UnknownFunction
+};
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief outcome of a deserialization
+ *
+ * @details Deserializers report errors through this instead of
+ * exceptions. On success the position is the number of bytes consumed,
+ * on failure it is where the input was rejected.
+ */
+class DeserializationResult
+{
+public:
+    constexpr DeserializationResult(const DeserializationError error, const std::size_t position) :
+        error(error), position(position)
+    {
+    }
+
+    constexpr DeserializationError getError() const
+    {
+        return error;
+    }
+
+    constexpr std::size_t getPosition() const
+    {
+        return position;
+    }
+
+    constexpr explicit operator bool() const
+    {
+        return error == DeserializationError::None;
+    }
+
+    static constexpr const char* getDescription(const DeserializationError error)
+    {
+        switch (error) {
+        case DeserializationError::None:
+            return "no error";
+        case DeserializationError::UnexpectedEnd:
+            return "unexpected end of input";
+        case DeserializationError::UnexpectedCharacter:
+            return "unexpected character";
+        case DeserializationError::InvalidNumber:
+            return "invalid number";
+        case DeserializationError::NumberOutOfRange:
+            return "number out of range";
+        case DeserializationError::InvalidString:
+            return "invalid string";
+        case DeserializationError::TypeMismatch:
+            return "value does not match the member type";
+        case DeserializationError::UnsupportedType:
+            return "member type can not be deserialized";
+        case DeserializationError::TooDeep:
+            return "nesting too deep";
+        case DeserializationError::TrailingCharacters:
+            return "trailing characters";
+        case DeserializationError::UnknownFunction:
+            return "no function with that name";
+        }
+        return "unknown error";
+    }
+
+private:
+    /** what went wrong, None on success */
+    DeserializationError error;
+    /** byte offset into the input */
+    std::size_t position;
+};
+} // Serialization
+#endif //__DESERIALIZATIONRESULT_H__
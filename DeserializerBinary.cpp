@@ -0,0 +1,652 @@
+/**
+ * @file DeserializerBinary.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief reader for the output of BinarySerializer
+ * @version 1.0
+ * @date 2020-08-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializerBinary.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Serialization::BinaryDeserializer::BinaryDeserializer() :
+    begin(nullptr), inSitu(nullptr), position(nullptr), end(nullptr), resource(nullptr),
+    error(DeserializationError::None)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Deserializes binary data into an object of a serializeable class.
+ *
+ * @details The data has to be written by BinarySerializer for a class
+ * with the same descriptor and has to be consumed completely.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data binary input
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::BinaryDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object)
+{
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+    start(data, size);
+    if (readValue(object) && (position != end)) {
+        fail(DeserializationError::TrailingCharacters);
+    }
+    scope.finish(position - begin);
+    return DeserializationResult(error, position - begin);
+}
+
+/**
+ * @brief Deserializes binary data, std::pmr strings and containers
+ * allocate from memoryResource.
+ *
+ * @details see JSONDeserializer::deserialize(...) with a memory resource.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data binary input
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @param memoryResource resource to allocate from, e.g. an Arena
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::BinaryDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object,
+    std::pmr::memory_resource& memoryResource)
+{
+    resource = &memoryResource;
+    const DeserializationResult result = deserialize(data, size, object);
+    resource = nullptr;
+    return result;
+}
+
+/**
+ * @brief Deserializes an object, strings of std::string_view and
+ * const char* members point into data.
+ *
+ * @details const char* strings are moved over their length prefix to
+ * make room for the terminating zero, so data is modified.
+ * Strings are read without allocating, data has to outlive the object.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data binary input, modified
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::BinaryDeserializer::deserializeInSitu(
+    char* const data,
+    const std::size_t size,
+    SerializeableT& object)
+{
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+    start(data, size);
+    inSitu = data;
+    if (readValue(object) && (position != end)) {
+        fail(DeserializationError::TrailingCharacters);
+    }
+    scope.finish(position - begin);
+    return DeserializationResult(error, position - begin);
+}
+
+/**
+ * @brief Deserializes a single value at the start of data, more input can follow.
+ *
+ * @details For formats that embed binary values, the position of the
+ * result is where the value ends. Described classes are instrumented
+ * like deserialize(...).
+ *
+ * @tparam ValueT any serializeable type
+ * @param data binary input
+ * @param size number of bytes in data
+ * @param value value to fill
+ * @return DeserializationResult error and bytes of the value
+ */
+template <class ValueT>
+Serialization::DeserializationResult Serialization::BinaryDeserializer::deserializePrefix(
+    const char* const data,
+    const std::size_t size,
+    ValueT& value)
+{
+    start(data, size);
+    if constexpr (TypeTraits::isDescribed<ValueT>) {
+        Instrumentation::Scope<ValueT> scope(InstrumentedOperation::Deserialize, 0);
+        readValue(value);
+        scope.finish(position - begin);
+    } else {
+        readValue(value);
+    }
+    return DeserializationResult(error, position - begin);
+}
+
+/**
+ * @brief Deserializes consecutive objects written by BinarySerializer::serializeArray(...).
+ *
+ * @details Described objects are instrumented as count calls of
+ * deserialize(...) sharing the time of the whole array.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data binary input
+ * @param size number of bytes in data
+ * @param objects objects to fill
+ * @param count number of objects
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::BinaryDeserializer::deserializeArray(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT* const objects,
+    const std::size_t count)
+{
+    start(data, size);
+    if constexpr (TypeTraits::isDescribed<SerializeableT>) {
+        Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+        readArray(objects, count);
+        scope.finish(position - begin, count);
+    } else {
+        readArray(objects, count);
+    }
+    if ((error == DeserializationError::None) && (position != end)) {
+        fail(DeserializationError::TrailingCharacters);
+    }
+    return DeserializationResult(error, position - begin);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief reads consecutive objects, copies them as a whole if their
+ * memory equals the encoding.
+ *
+ * @tparam SerializeableT any serializeable type
+ * @param objects objects to fill
+ * @param count number of objects
+ * @return true on success
+ */
+template <class SerializeableT>
+bool Serialization::BinaryDeserializer::readArray(SerializeableT* const objects, const std::size_t count)
+{
+    if constexpr (BinaryEncoding::isBulkDecodable<SerializeableT>()) {
+        const char* bytes = nullptr;
+        if (!take(count * sizeof(SerializeableT), bytes)) {
+            return false;
+        }
+        std::memcpy(static_cast<void*>(objects), bytes, count * sizeof(SerializeableT));
+        return true;
+    } else {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            if (!readValue(objects[ii])) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief reads all members of a serializeable class in descriptor order.
+ *
+ * @details copies the whole object if its memory equals the encoding.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param object object to fill
+ * @return true on success
+ */
+template <class SerializeableT,
+    typename std::enable_if_t<Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+bool Serialization::BinaryDeserializer::readValue(SerializeableT& object)
+{
+    if constexpr (BinaryEncoding::isBulkDecodable<SerializeableT>()) {
+        const char* bytes = nullptr;
+        if (!take(sizeof(SerializeableT), bytes)) {
+            return false;
+        }
+        std::memcpy(static_cast<void*>(&object), bytes, sizeof(SerializeableT));
+        return true;
+    } else {
+        return readMembers(object, std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+    }
+}
+
+/**
+ * @brief reads a length prefixed string into a std::string.
+ *
+ * @tparam StringT std::string
+ * @param value string to fill, previous content is replaced
+ * @return true on success
+ */
+template <class StringT,
+    typename std::enable_if_t<Serialization::TypeTraits::isString<StringT>, int>>
+bool Serialization::BinaryDeserializer::readValue(StringT& value)
+{
+    std::size_t length = 0;
+    const char* bytes = nullptr;
+    if (!readLength(length) || !take(length, bytes)) {
+        return false;
+    }
+    Arena::bind(value, resource);
+    value.assign(bytes, length);
+    return true;
+}
+
+/**
+ * @brief reads a std::vector with its element count or a std::array.
+ *
+ * @details Elements whose memory equals the encoding are copied
+ * as a whole, others are read one by one.
+ *
+ * @tparam SequenceT std::vector or std::array
+ * @param sequence sequence to fill
+ * @return true on success
+ */
+template <class SequenceT,
+    typename std::enable_if_t<Serialization::TypeTraits::isSequence<SequenceT>, int>>
+bool Serialization::BinaryDeserializer::readValue(SequenceT& sequence)
+{
+    using ElementT = typename SequenceT::value_type;
+
+    if constexpr (!TypeTraits::isFixedSequence<SequenceT>) {
+        std::size_t count = 0;
+        if (!readLength(count)) {
+            return false;
+        }
+        Arena::bind(sequence, resource);
+        if constexpr (TypeTraits::isBulkSequence<SequenceT> && BinaryEncoding::isBulkDecodable<ElementT>()) {
+            const char* bytes = nullptr;
+            if ((count > static_cast<std::size_t>(end - position) / sizeof(ElementT)) ||
+                !take(count * sizeof(ElementT), bytes)) {
+                return fail(DeserializationError::UnexpectedEnd);
+            }
+            sequence.resize(count);
+            std::memcpy(sequence.data(), bytes, count * sizeof(ElementT));
+            return true;
+        } else {
+            // the count is not trusted for the allocation, every element takes input
+            sequence.clear();
+            sequence.reserve(std::min(count, static_cast<std::size_t>(end - position)));
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                if constexpr (std::uses_allocator_v<ElementT, typename SequenceT::allocator_type>) {
+                    // constructed with the allocator of the sequence, e.g. the strings of a std::pmr::vector
+                    if (!readValue(sequence.emplace_back())) {
+                        return false;
+                    }
+                } else {
+                    ElementT element{};
+                    if (!readValue(element)) {
+                        return false;
+                    }
+                    sequence.push_back(std::move(element));
+                }
+            }
+            return true;
+        }
+    } else if constexpr (TypeTraits::isBulkSequence<SequenceT> && BinaryEncoding::isBulkDecodable<ElementT>()) {
+        const char* bytes = nullptr;
+        if (!take(sizeof(SequenceT), bytes)) {
+            return false;
+        }
+        std::memcpy(sequence.data(), bytes, sizeof(SequenceT));
+        return true;
+    } else {
+        for (auto& element : sequence) {
+            if (!readValue(element)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief reads the presence byte of a std::optional and the value if present.
+ *
+ * @tparam OptionalT std::optional
+ * @param optional reset or filled
+ * @return true on success
+ */
+template <class OptionalT,
+    typename std::enable_if_t<Serialization::TypeTraits::isOptional<OptionalT>, int>>
+bool Serialization::BinaryDeserializer::readValue(OptionalT& optional)
+{
+    bool hasValue = false;
+    if (!readValue(hasValue)) {
+        return false;
+    }
+    if (!hasValue) {
+        optional.reset();
+        return true;
+    }
+    return readValue(optional.emplace());
+}
+
+/**
+ * @brief reads a little endian integer of the width of IntegerT.
+ *
+ * @tparam IntegerT integral type except char and bool
+ * @param value integer to fill
+ * @return true on success
+ */
+template <class IntegerT,
+    typename std::enable_if_t<Serialization::TypeTraits::isInteger<IntegerT>, int>>
+bool Serialization::BinaryDeserializer::readValue(IntegerT& value)
+{
+    using FixedT = TypeTraits::FixedWidthType<IntegerT>;
+
+    const char* bytes = nullptr;
+    if (!take(sizeof(FixedT), bytes)) {
+        return false;
+    }
+    value = static_cast<IntegerT>(BinaryEncoding::read<FixedT>(bytes));
+    return true;
+}
+
+/**
+ * @brief reads the IEEE 754 bits of a float or double.
+ *
+ * @tparam FloatT float or double
+ * @param value floating point to fill
+ * @return true on success
+ */
+template <class FloatT,
+    typename std::enable_if_t<Serialization::TypeTraits::isFloatingPoint<FloatT>, int>>
+bool Serialization::BinaryDeserializer::readValue(FloatT& value)
+{
+    using BitsT = std::conditional_t<sizeof(FloatT) == 4, std::uint32_t, std::uint64_t>;
+
+    const char* bytes = nullptr;
+    if (!take(sizeof(BitsT), bytes)) {
+        return false;
+    }
+    value = std::bit_cast<FloatT>(BinaryEncoding::read<BitsT>(bytes));
+    return true;
+}
+
+inline bool Serialization::BinaryDeserializer::readValue(int& value)
+{
+    const char* bytes = nullptr;
+    if (!take(sizeof(BinaryEncoding::IntType), bytes)) {
+        return false;
+    }
+    const BinaryEncoding::IntType decoded = BinaryEncoding::read<BinaryEncoding::IntType>(bytes);
+    if constexpr (sizeof(int) < sizeof(BinaryEncoding::IntType)) {
+        if ((decoded < std::numeric_limits<int>::min()) || (decoded > std::numeric_limits<int>::max())) {
+            return fail(DeserializationError::NumberOutOfRange);
+        }
+    }
+    value = static_cast<int>(decoded);
+    return true;
+}
+
+inline bool Serialization::BinaryDeserializer::readValue(char& value)
+{
+    const char* bytes = nullptr;
+    if (!take(1, bytes)) {
+        return false;
+    }
+    value = *bytes;
+    return true;
+}
+
+/**
+ * @brief reads a bool, only 0 and 1 are valid.
+ *
+ * @param value bool to fill
+ * @return true on success
+ */
+inline bool Serialization::BinaryDeserializer::readValue(bool& value)
+{
+    const char* bytes = nullptr;
+    if (!take(1, bytes)) {
+        return false;
+    }
+    if ((*bytes != '\0') && (*bytes != '\1')) {
+        position = bytes;
+        return fail(DeserializationError::TypeMismatch);
+    }
+    value = (*bytes == '\1');
+    return true;
+}
+
+/**
+ * @brief strings can only be stored in a const char* member in situ,
+ * where the input is the storage.
+ *
+ * @details The length prefix is not needed anymore once read, so the
+ * string is moved onto it, leaving room for the terminating zero.
+ *
+ * @param value set to the string
+ * @return true on success
+ */
+inline bool Serialization::BinaryDeserializer::readValue(const char*& value)
+{
+    if (inSitu == nullptr) {
+        return fail(DeserializationError::UnsupportedType);
+    }
+    std::size_t length = 0;
+    const char* bytes = nullptr;
+    if (!readLength(length) || !take(length, bytes)) {
+        return false;
+    }
+    char* const string = inSitu + (bytes - begin) - sizeof(BinaryEncoding::LengthType);
+    std::memmove(string, bytes, length);
+    string[length] = '\0';
+    value = string;
+    return true;
+}
+
+/**
+ * @brief views a string of the input, only in situ.
+ *
+ * @param value set to the string
+ * @return true on success
+ */
+inline bool Serialization::BinaryDeserializer::readValue(std::string_view& value)
+{
+    if (inSitu == nullptr) {
+        return fail(DeserializationError::UnsupportedType);
+    }
+    std::size_t length = 0;
+    const char* bytes = nullptr;
+    if (!readLength(length) || !take(length, bytes)) {
+        return false;
+    }
+    value = std::string_view(bytes, length);
+    return true;
+}
+
+/**
+ * @brief reads every descriptor of a class in order.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Indices positions of all descriptors
+ * @param object object to fill
+ * @return true on success
+ */
+template <class SerializeableT, std::size_t... Indices>
+bool Serialization::BinaryDeserializer::readMembers(SerializeableT& object, std::index_sequence<Indices...>)
+{
+    return (readMemberValue(object, Descriptor::getDescriptor<SerializeableT, Indices>()) && ...);
+}
+
+/**
+ * @brief reads the value into the member, const members are skipped.
+ *
+ * @tparam SerializeableT
+ * @tparam MemberT
+ * @param object object to fill
+ * @param descriptor descriptor of the member
+ * @return true on success
+ */
+template <class SerializeableT, class MemberT>
+bool Serialization::BinaryDeserializer::readMemberValue(
+    SerializeableT& object,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    using ValueType = typename MemberDescriptor<SerializeableT, MemberT>::ValueType;
+
+    if constexpr (MemberDescriptor<SerializeableT, MemberT>::isWriteable) {
+        if (resource != nullptr) {
+            // assigning would copy std::pmr members back to their old resource
+            return readValue(object.*descriptor.getMember());
+        }
+        return descriptor.readMemberValue(object, [this](ValueType& value) { return readValue(value); });
+    } else {
+        return skipValue<ValueType>();
+    }
+}
+
+/**
+ * @brief functions have no value
+ *
+ * @return true
+ */
+template <class SerializeableT, class ReturnT, class... ArgTs>
+bool Serialization::BinaryDeserializer::readMemberValue(
+    SerializeableT& object,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return true;
+}
+
+/**
+ * @brief skips a value of the given type.
+ *
+ * @tparam ValueT type of the value
+ * @return true on success
+ */
+template <class ValueT>
+bool Serialization::BinaryDeserializer::skipValue()
+{
+    if constexpr (std::is_same_v<const char*, ValueT> || TypeTraits::isString<ValueT>) {
+        return skipString();
+    } else if constexpr (TypeTraits::isDescribed<ValueT>) {
+        return skipMembers<ValueT>(std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+    } else {
+        ValueT value{};
+        return readValue(value);
+    }
+}
+
+template <class SerializeableT, std::size_t... Indices>
+bool Serialization::BinaryDeserializer::skipMembers(std::index_sequence<Indices...>)
+{
+    return (skipMemberValue(Descriptor::getDescriptor<SerializeableT, Indices>()) && ...);
+}
+
+template <class SerializeableT, class MemberT>
+bool Serialization::BinaryDeserializer::skipMemberValue(const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return skipValue<typename MemberDescriptor<SerializeableT, MemberT>::ValueType>();
+}
+
+template <class SerializeableT, class ReturnT, class... ArgTs>
+bool Serialization::BinaryDeserializer::skipMemberValue(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return true;
+}
+
+/**
+ * @brief skips a length prefixed string.
+ *
+ * @return true on success
+ */
+inline bool Serialization::BinaryDeserializer::skipString()
+{
+    std::size_t length = 0;
+    const char* bytes = nullptr;
+    return readLength(length) && take(length, bytes);
+}
+
+/**
+ * @brief reads the length in front of strings and vectors.
+ *
+ * @param length set to the decoded length
+ * @return true on success
+ */
+inline bool Serialization::BinaryDeserializer::readLength(std::size_t& length)
+{
+    const char* bytes = nullptr;
+    if (!take(sizeof(BinaryEncoding::LengthType), bytes)) {
+        return false;
+    }
+    length = BinaryEncoding::read<BinaryEncoding::LengthType>(bytes);
+    return true;
+}
+
+/**
+ * @brief consumes the next bytes of the input.
+ *
+ * @param size number of bytes needed
+ * @param bytes set to the first byte
+ * @return true if enough input is left
+ */
+inline bool Serialization::BinaryDeserializer::take(const std::size_t size, const char*& bytes)
+{
+    if (static_cast<std::size_t>(end - position) < size) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    bytes = position;
+    position += size;
+    return true;
+}
+
+/**
+ * @brief resets the state for a new input, not in situ.
+ *
+ * @param data input
+ * @param size number of bytes in data
+ */
+inline void Serialization::BinaryDeserializer::start(const char* const data, const std::size_t size)
+{
+    begin = data;
+    inSitu = nullptr;
+    position = data;
+    end = data + size;
+    error = DeserializationError::None;
+}
+
+/**
+ * @brief records the first error
+ *
+ * @param reason what went wrong
+ * @return false, to be returned by the caller
+ */
+inline bool Serialization::BinaryDeserializer::fail(const DeserializationError reason)
+{
+    if (error == DeserializationError::None) {
+        error = reason;
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,181 @@
+/**
+ * @file DeserializerBinary.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief reader for the output of BinarySerializer
+ * @version 1.0
+ * @date 2020-08-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __DESERIALIZERBINARY_H__
+#define __DESERIALIZERBINARY_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class BinaryDeserializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Arena.h"
+#include "BinaryEncoding.h"
+#include "BinaryScanner.h"
+#include "DeserializationResult.h"
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "TypeTraits.h"
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief reader for the output of BinarySerializer
+ *
+ * @details The input carries no names, so the values are read in the
+ * order of the descriptors and written through the MemberDescriptors.
+ * Const members are read but not written. Objects whose memory equals
+ * the encoding (BinaryEncoding::isBulkDecodable()) are copied as a whole.
+ * Errors are returned as DeserializationResult, no exceptions are thrown.
+ * Holds the parse position, so use one instance per thread.
+ *
+ * deserializeInSitu(...) additionally fills std::string_view and
+ * const char* members with strings in the input, see JSONDeserializer.
+ * Given a std::pmr::memory_resource like an Arena, every std::pmr::string
+ * and std::pmr::vector that is filled allocates from it.
+ */
+class BinaryDeserializer
+{
+    /** decodes call arguments with the value readers */
+    template <class SerializeableT>
+    friend class CallDispatcher;
+
+    // delete default constructors
+    BinaryDeserializer(const BinaryDeserializer& other) = delete;
+    BinaryDeserializer& operator=(const BinaryDeserializer& other) = delete;
+public:
+    /** finds the end of objects in chunked input for IncrementalDeserializer */
+    template <class SerializeableT>
+    using Scanner = BinaryScanner<SerializeableT>;
+
+    BinaryDeserializer();
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(const char* const data, const std::size_t size, SerializeableT& object);
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(
+        const char* const data,
+        const std::size_t size,
+        SerializeableT& object,
+        std::pmr::memory_resource& memoryResource);
+
+    template <class SerializeableT>
+    DeserializationResult deserializeInSitu(char* const data, const std::size_t size, SerializeableT& object);
+
+    template <class ValueT>
+    DeserializationResult deserializePrefix(const char* const data, const std::size_t size, ValueT& value);
+
+    template <class SerializeableT>
+    DeserializationResult deserializeArray(
+        const char* const data,
+        const std::size_t size,
+        SerializeableT* const objects,
+        const std::size_t count);
+
+private:
+    template <class SerializeableT,
+        typename std::enable_if_t<TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    bool readValue(SerializeableT& object);
+
+    template <class StringT,
+        typename std::enable_if_t<TypeTraits::isString<StringT>, int>  = 0>
+    bool readValue(StringT& value);
+
+    template <class SequenceT,
+        typename std::enable_if_t<TypeTraits::isSequence<SequenceT>, int>  = 0>
+    bool readValue(SequenceT& sequence);
+
+    template <class OptionalT,
+        typename std::enable_if_t<TypeTraits::isOptional<OptionalT>, int>  = 0>
+    bool readValue(OptionalT& optional);
+
+    template <class IntegerT,
+        typename std::enable_if_t<TypeTraits::isInteger<IntegerT>, int>  = 0>
+    bool readValue(IntegerT& value);
+
+    template <class FloatT,
+        typename std::enable_if_t<TypeTraits::isFloatingPoint<FloatT>, int>  = 0>
+    bool readValue(FloatT& value);
+
+    bool readValue(int& value);
+    bool readValue(char& value);
+    bool readValue(bool& value);
+    bool readValue(const char*& value);
+    bool readValue(std::string_view& value);
+
+    template <class SerializeableT>
+    bool readArray(SerializeableT* const objects, const std::size_t count);
+
+    template <class SerializeableT, std::size_t... Indices>
+    bool readMembers(SerializeableT& object, std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    bool readMemberValue(
+        SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    bool readMemberValue(
+        SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class ValueT>
+    bool skipValue();
+
+    template <class SerializeableT, std::size_t... Indices>
+    bool skipMembers(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    bool skipMemberValue(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    bool skipMemberValue(const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    bool readLength(std::size_t& length);
+    bool skipString();
+    bool take(const std::size_t size, const char*& bytes);
+    void start(const char* const data, const std::size_t size);
+    bool fail(const DeserializationError reason);
+
+    /** start of the input */
+    const char* begin;
+    /** same memory as begin if deserializing in situ, nullptr otherwise */
+    char* inSitu;
+    /** next byte to read */
+    const char* position;
+    /** end of the input */
+    const char* end;
+    /** resource for std::pmr strings and containers, nullptr to keep theirs */
+    std::pmr::memory_resource* resource;
+    /** first error, None while reading succeeds */
+    DeserializationError error;
+};
+} // Serialization
+
+// template functions, include src
+#include "DeserializerBinary.cpp"
+#endif //__DESERIALIZERBINARY_H__
@@ -0,0 +1,218 @@
+/**
+ * @file DeserializerDelta.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief applies the output of DeltaSerializer to a baseline
+ * @version 1.0
+ * @date 2020-08-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializerDelta.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Serialization::DeltaDeserializer::DeltaDeserializer() :
+    values(), begin(nullptr), position(nullptr), end(nullptr), error(DeserializationError::None)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Applies a delta to the baseline it was made against.
+ *
+ * @details The delta is read into a copy of the baseline, which replaces
+ * the baseline once the whole input is read. Classes that can not be
+ * assigned, like those with const members, are updated in place instead,
+ * their baseline is undefined after an error.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data output of DeltaSerializer
+ * @param size number of bytes in data
+ * @param baseline object to update, becomes the object the delta was made of, unchanged on error
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::DeltaDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& baseline)
+{
+    static_assert(TypeTraits::isDescribed<SerializeableT>, "deltas are made of described classes");
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+    start(data, size);
+    if constexpr (std::is_copy_constructible_v<SerializeableT> && std::is_move_assignable_v<SerializeableT>) {
+        SerializeableT object = baseline;
+        if (readDelta(object)) {
+            if (position != end) {
+                fail(DeserializationError::TrailingCharacters);
+            } else {
+                baseline = std::move(object);
+            }
+        }
+    } else {
+        if (readDelta(baseline) && (position != end)) {
+            fail(DeserializationError::TrailingCharacters);
+        }
+    }
+    scope.finish(position - begin);
+    return DeserializationResult(error, position - begin);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief reads the bitmask of a class and the members it marks.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param object object to update
+ * @return true on success
+ */
+template <class SerializeableT>
+bool Serialization::DeltaDeserializer::readDelta(SerializeableT& object)
+{
+    constexpr std::size_t memberCount = Descriptor::getMemberCount<SerializeableT>();
+    constexpr std::size_t maskSize = (memberCount + 7) / 8;
+
+    const char* mask = nullptr;
+    if (!take(maskSize, mask)) {
+        return false;
+    }
+    // bits behind the last member are never set
+    if constexpr ((memberCount % 8) != 0) {
+        if ((static_cast<unsigned char>(mask[maskSize - 1]) >> (memberCount % 8)) != 0) {
+            position = mask;
+            return fail(DeserializationError::TypeMismatch);
+        }
+    }
+    return readChanges(object, mask, std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+}
+
+template <class SerializeableT, std::size_t... Indices>
+bool Serialization::DeltaDeserializer::readChanges(
+    SerializeableT& object,
+    const char* const mask,
+    std::index_sequence<Indices...>)
+{
+    return (readChange<Indices>(object, mask, Descriptor::getDescriptor<SerializeableT, Indices>()) && ...);
+}
+
+/**
+ * @brief sets a member if its bit is set, const members are read but not set.
+ *
+ * @tparam Index position of the member in makeClassDescriptor(...)
+ * @param object object to update
+ * @param mask bitmask of the class
+ * @param descriptor descriptor of the member
+ * @return true on success
+ */
+template <std::size_t Index, class SerializeableT, class MemberT>
+bool Serialization::DeltaDeserializer::readChange(
+    SerializeableT& object,
+    const char* const mask,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    using ValueType = typename MemberDescriptor<SerializeableT, MemberT>::ValueType;
+    constexpr std::size_t bit = Descriptor::getMemberPosition<SerializeableT, Index>();
+
+    if ((static_cast<unsigned char>(mask[bit / 8]) & (1 << (bit % 8))) == 0) {
+        return true;
+    }
+    // nested classes are updated member by member, everything else is replaced
+    if constexpr (MemberDescriptor<SerializeableT, MemberT>::isWriteable) {
+        return descriptor.readMemberValue(object, [this](ValueType& value) { return readValue(value); });
+    } else {
+        ValueType value = descriptor.getMemberValue(object);
+        return readValue(value);
+    }
+}
+
+/**
+ * @brief functions have no bit
+ *
+ * @return true
+ */
+template <std::size_t Index, class SerializeableT, class ReturnT, class... ArgTs>
+bool Serialization::DeltaDeserializer::readChange(
+    SerializeableT& object,
+    const char* const mask,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return true;
+}
+
+/**
+ * @brief reads a changed value, a delta for described classes.
+ *
+ * @tparam ValueT any serializeable type
+ * @param value value to update
+ * @return true on success
+ */
+template <class ValueT>
+bool Serialization::DeltaDeserializer::readValue(ValueT& value)
+{
+    if constexpr (TypeTraits::isDescribed<ValueT>) {
+        return readDelta(value);
+    } else {
+        const DeserializationResult result = values.deserializePrefix(position, end - position, value);
+        position += result.getPosition();
+        return result || fail(result.getError());
+    }
+}
+
+/**
+ * @brief consumes the next bytes of the input.
+ *
+ * @param size number of bytes needed
+ * @param bytes set to the first byte
+ * @return true if enough input is left
+ */
+inline bool Serialization::DeltaDeserializer::take(const std::size_t size, const char*& bytes)
+{
+    if (static_cast<std::size_t>(end - position) < size) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    bytes = position;
+    position += size;
+    return true;
+}
+
+/**
+ * @brief resets the state for a new input.
+ *
+ * @param data input
+ * @param size number of bytes in data
+ */
+inline void Serialization::DeltaDeserializer::start(const char* const data, const std::size_t size)
+{
+    begin = data;
+    position = data;
+    end = data + size;
+    error = DeserializationError::None;
+}
+
+/**
+ * @brief records the first error
+ *
+ * @param reason what went wrong
+ * @return false, to be returned by the caller
+ */
+inline bool Serialization::DeltaDeserializer::fail(const DeserializationError reason)
+{
+    if (error == DeserializationError::None) {
+        error = reason;
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
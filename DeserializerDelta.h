@@ -0,0 +1,105 @@
+/**
+ * @file DeserializerDelta.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief applies the output of DeltaSerializer to a baseline
+ * @version 1.0
+ * @date 2020-08-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __DESERIALIZERDELTA_H__
+#define __DESERIALIZERDELTA_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class DeltaDeserializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializationResult.h"
+#include "DeserializerBinary.h"
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "TypeTraits.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief applies the output of DeltaSerializer to a baseline
+ *
+ * @details Reads the bitmask of each class and sets the members whose
+ * bit is set through their MemberDescriptor, the others keep their value.
+ * Nested described members are updated member by member as well.
+ * The baseline has to be the one the delta was made against. It only
+ * changes once the whole delta is read, a cut or corrupt delta leaves it
+ * as it was. Classes that can not be assigned are updated in place and
+ * have to be replaced by a complete object after an error.
+ * Errors are returned as DeserializationResult, no exceptions are thrown.
+ */
+class DeltaDeserializer
+{
+    // delete default constructors
+    DeltaDeserializer(const DeltaDeserializer& other) = delete;
+    DeltaDeserializer& operator=(const DeltaDeserializer& other) = delete;
+public:
+    DeltaDeserializer();
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(const char* const data, const std::size_t size, SerializeableT& baseline);
+
+private:
+    template <class SerializeableT>
+    bool readDelta(SerializeableT& object);
+
+    template <class SerializeableT, std::size_t... Indices>
+    bool readChanges(SerializeableT& object, const char* const mask, std::index_sequence<Indices...>);
+
+    template <std::size_t Index, class SerializeableT, class MemberT>
+    bool readChange(
+        SerializeableT& object,
+        const char* const mask,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <std::size_t Index, class SerializeableT, class ReturnT, class... ArgTs>
+    bool readChange(
+        SerializeableT& object,
+        const char* const mask,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class ValueT>
+    bool readValue(ValueT& value);
+
+    bool take(const std::size_t size, const char*& bytes);
+    void start(const char* const data, const std::size_t size);
+    bool fail(const DeserializationError reason);
+
+    /** reads the changed values */
+    BinaryDeserializer values;
+    /** start of the input */
+    const char* begin;
+    /** next byte to read */
+    const char* position;
+    /** end of the input */
+    const char* end;
+    /** first error, None while reading succeeds */
+    DeserializationError error;
+};
+} // Serialization
+
+// template functions, include src
+#include "DeserializerDelta.cpp"
+#endif //__DESERIALIZERDELTA_H__
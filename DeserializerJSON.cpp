@@ -0,0 +1,1063 @@
+/**
+ * @file DeserializerJSON.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief automatic json deserializer
+ * @version 1.0
+ * @date 2020-08-03
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializerJSON.h"
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Serialization::JSONDeserializer::JSONDeserializer() :
+    begin(nullptr), inSitu(nullptr), position(nullptr), end(nullptr), depth(0), resource(nullptr),
+    error(DeserializationError::None)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Deserializes a json object into an object of a serializeable class.
+ *
+ * @details A class is serializeable, if it has a static descriptor.
+ * Only whitespace may follow the json object.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data json input
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::JSONDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object)
+{
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+    start(data, size);
+    const DeserializationResult result = parse(object);
+    scope.finish(result.getPosition());
+    return result;
+}
+
+/**
+ * @brief Deserializes a json object, std::pmr strings and containers
+ * allocate from memoryResource.
+ *
+ * @details Members on another resource are replaced by empty ones on
+ * memoryResource before they are filled, see Arena::bind(...).
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data json input
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @param memoryResource resource to allocate from, e.g. an Arena
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::JSONDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object,
+    std::pmr::memory_resource& memoryResource)
+{
+    resource = &memoryResource;
+    const DeserializationResult result = deserialize(data, size, object);
+    resource = nullptr;
+    return result;
+}
+
+/**
+ * @brief Deserializes a json object, strings of std::string_view and
+ * const char* members point into data.
+ *
+ * @details Strings with escape sequences are unescaped in place and
+ * const char* strings are terminated in place, so data is modified.
+ * Strings are read without allocating, data has to outlive the object.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param data json input, modified
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::JSONDeserializer::deserializeInSitu(
+    char* const data,
+    const std::size_t size,
+    SerializeableT& object)
+{
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+    start(data, size);
+    inSitu = data;
+    const DeserializationResult result = parse(object);
+    scope.finish(result.getPosition());
+    return result;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief reads the json object of the input started with start(...).
+ *
+ * @details Only whitespace may follow the json object.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param object object to fill
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::JSONDeserializer::parse(SerializeableT& object)
+{
+    skipWhitespace();
+    if (readValue(object)) {
+        skipWhitespace();
+        if (position != end) {
+            fail(DeserializationError::TrailingCharacters);
+        }
+    }
+    return DeserializationResult(error, position - begin);
+}
+
+/**
+ * @brief reads a json object into a serializeable class.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @param object object to fill
+ * @return true on success
+ */
+template <class SerializeableT,
+    typename std::enable_if_t<Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+bool Serialization::JSONDeserializer::readValue(SerializeableT& object)
+{
+    if (++depth > maxDepth) {
+        return fail(DeserializationError::TooDeep);
+    }
+    if (!expect('{')) {
+        return false;
+    }
+
+    skipWhitespace();
+    if ((position != end) && (*position == '}')) {
+        ++position;
+        --depth;
+        return true;
+    }
+
+    constexpr std::size_t count = Descriptor::getDescriptorCount<SerializeableT>();
+    for (;;) {
+        const char* key = nullptr;
+        std::size_t keyLength = 0;
+        if (!readKey(key, keyLength)) {
+            return false;
+        }
+        skipWhitespace();
+        if (!expect(':')) {
+            return false;
+        }
+        skipWhitespace();
+        if (!readMember(object, key, keyLength, std::make_index_sequence<count>())) {
+            return false;
+        }
+
+        skipWhitespace();
+        if (position == end) {
+            return fail(DeserializationError::UnexpectedEnd);
+        }
+        if (*position == ',') {
+            ++position;
+            skipWhitespace();
+        } else if (*position == '}') {
+            ++position;
+            --depth;
+            return true;
+        } else {
+            return fail(DeserializationError::UnexpectedCharacter);
+        }
+    }
+}
+
+/**
+ * @brief reads a json string into a std::string.
+ *
+ * @details Runs without escape sequences are appended as a whole,
+ * escape sequences are decoded one by one.
+ *
+ * @tparam StringT std::string
+ * @param value string to fill, previous content is replaced
+ * @return true on success
+ */
+template <class StringT,
+    typename std::enable_if_t<Serialization::TypeTraits::isString<StringT>, int>>
+bool Serialization::JSONDeserializer::readValue(StringT& value)
+{
+    if ((position == end) || (*position != '"')) {
+        return fail((position == end) ? DeserializationError::UnexpectedEnd : DeserializationError::TypeMismatch);
+    }
+    ++position;
+
+    Arena::bind(value, resource);
+    value.clear();
+    const char* run = position;
+    while (position != end) {
+        const char character = *position;
+        if (character == '"') {
+            value.append(run, position - run);
+            ++position;
+            return true;
+        }
+        if (static_cast<unsigned char>(character) < 0x20) {
+            return fail(DeserializationError::InvalidString);
+        }
+        if (character == '\\') {
+            value.append(run, position - run);
+            ++position;
+            char decoded[4];
+            char* output = decoded;
+            if (!readEscape(output, decoded + sizeof(decoded))) {
+                return false;
+            }
+            value.append(decoded, output - decoded);
+            run = position;
+            continue;
+        }
+        ++position;
+    }
+    return fail(DeserializationError::UnexpectedEnd);
+}
+
+/**
+ * @brief reads a json array into a std::vector or std::array.
+ *
+ * @details A std::vector takes any number of elements, a std::array
+ * exactly as many as it holds.
+ *
+ * @tparam SequenceT std::vector or std::array
+ * @param sequence sequence to fill, a vector is cleared first
+ * @return true on success
+ */
+template <class SequenceT,
+    typename std::enable_if_t<Serialization::TypeTraits::isSequence<SequenceT>, int>>
+bool Serialization::JSONDeserializer::readValue(SequenceT& sequence)
+{
+    if (position == end) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    if (*position != '[') {
+        return fail(DeserializationError::TypeMismatch);
+    }
+    if (++depth > maxDepth) {
+        return fail(DeserializationError::TooDeep);
+    }
+    ++position;
+
+    if constexpr (!TypeTraits::isFixedSequence<SequenceT>) {
+        Arena::bind(sequence, resource);
+        sequence.clear();
+    }
+    std::size_t count = 0;
+    skipWhitespace();
+    if ((position != end) && (*position == ']')) {
+        ++position;
+    } else {
+        for (;;) {
+            if constexpr (TypeTraits::isFixedSequence<SequenceT>) {
+                if (count == sequence.size()) {
+                    return fail(DeserializationError::TypeMismatch);
+                }
+                if (!readValue(sequence[count])) {
+                    return false;
+                }
+            } else if constexpr (std::uses_allocator_v<typename SequenceT::value_type, typename SequenceT::allocator_type>) {
+                // constructed with the allocator of the sequence, e.g. the strings of a std::pmr::vector
+                if (!readValue(sequence.emplace_back())) {
+                    return false;
+                }
+            } else {
+                typename SequenceT::value_type element{};
+                if (!readValue(element)) {
+                    return false;
+                }
+                sequence.push_back(std::move(element));
+            }
+            ++count;
+
+            skipWhitespace();
+            if (position == end) {
+                return fail(DeserializationError::UnexpectedEnd);
+            }
+            if (*position == ',') {
+                ++position;
+                skipWhitespace();
+            } else if (*position == ']') {
+                ++position;
+                break;
+            } else {
+                return fail(DeserializationError::UnexpectedCharacter);
+            }
+        }
+    }
+    --depth;
+
+    if constexpr (TypeTraits::isFixedSequence<SequenceT>) {
+        if (count != sequence.size()) {
+            return fail(DeserializationError::TypeMismatch);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief reads null or a value into a std::optional.
+ *
+ * @tparam OptionalT std::optional
+ * @param optional reset on null, holds the value otherwise
+ * @return true on success
+ */
+template <class OptionalT,
+    typename std::enable_if_t<Serialization::TypeTraits::isOptional<OptionalT>, int>>
+bool Serialization::JSONDeserializer::readValue(OptionalT& optional)
+{
+    if ((position != end) && (*position == 'n')) {
+        optional.reset();
+        return readLiteral("null", 4);
+    }
+    return readValue(optional.emplace());
+}
+
+/**
+ * @brief reads an integer of any width.
+ *
+ * @tparam IntegerT integral type except char and bool
+ * @param value integer to fill
+ * @return true on success
+ */
+template <class IntegerT,
+    typename std::enable_if_t<Serialization::TypeTraits::isInteger<IntegerT>, int>>
+bool Serialization::JSONDeserializer::readValue(IntegerT& value)
+{
+    return readInteger(value);
+}
+
+/**
+ * @brief reads a json number into a float or double, null is read as NaN.
+ *
+ * @details std::from_chars rounds correctly, so every value written
+ * by the serializers reads back to the same bits.
+ *
+ * @tparam FloatT float or double
+ * @param value floating point to fill
+ * @return true on success
+ */
+template <class FloatT,
+    typename std::enable_if_t<Serialization::TypeTraits::isFloatingPoint<FloatT>, int>>
+bool Serialization::JSONDeserializer::readValue(FloatT& value)
+{
+    if ((position != end) && (*position == 'n')) {
+        value = std::numeric_limits<FloatT>::quiet_NaN();
+        return readLiteral("null", 4);
+    }
+    // from_chars also accepts inf, nan, hex digits and leading zeros, json does not
+    const char* const digits = ((position != end) && (*position == '-')) ? position + 1 : position;
+    if ((digits == end) || (*digits < '0') || (*digits > '9') || hasLeadingZero(digits)) {
+        return fail(DeserializationError::InvalidNumber);
+    }
+
+    const std::from_chars_result result = std::from_chars(position, end, value);
+    if (result.ec == std::errc::result_out_of_range) {
+        return fail(DeserializationError::NumberOutOfRange);
+    }
+    if (result.ec != std::errc()) {
+        return fail(DeserializationError::InvalidNumber);
+    }
+    position = result.ptr;
+    return true;
+}
+
+inline bool Serialization::JSONDeserializer::readValue(int& value)
+{
+    return readInteger(value);
+}
+
+/**
+ * @brief reads a json string of exactly one character.
+ *
+ * @param value character to fill
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readValue(char& value)
+{
+    char buffer[4];
+    std::size_t length = 0;
+    if (!readString(buffer, sizeof(buffer), length)) {
+        return false;
+    }
+    if (length != 1) {
+        return fail(DeserializationError::TypeMismatch);
+    }
+    value = buffer[0];
+    return true;
+}
+
+inline bool Serialization::JSONDeserializer::readValue(bool& value)
+{
+    if ((position != end) && (*position == 't')) {
+        value = true;
+        return readLiteral("true", 4);
+    }
+    if ((position != end) && (*position == 'f')) {
+        value = false;
+        return readLiteral("false", 5);
+    }
+    return fail(DeserializationError::TypeMismatch);
+}
+
+/**
+ * @brief strings can only be stored in a const char* member in situ,
+ * where the input is the storage.
+ *
+ * @param value set to the string, terminated in place of the closing quote
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readValue(const char*& value)
+{
+    char* string = nullptr;
+    std::size_t length = 0;
+    if (!readStringInSitu(string, length)) {
+        return false;
+    }
+    string[length] = '\0';
+    value = string;
+    return true;
+}
+
+/**
+ * @brief views a string of the input, only in situ.
+ *
+ * @param value set to the unescaped string
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readValue(std::string_view& value)
+{
+    char* string = nullptr;
+    std::size_t length = 0;
+    if (!readStringInSitu(string, length)) {
+        return false;
+    }
+    value = std::string_view(string, length);
+    return true;
+}
+
+/**
+ * @brief finds the member with the given key and reads its value.
+ *
+ * @details The key is resolved to a tuple index by the perfect hash of
+ * the class descriptor, the index selects the reader for that descriptor
+ * from a table of function pointers. Values of unknown keys are skipped.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Indices positions of all descriptors
+ * @param object object to fill
+ * @param key key of the value, not zero terminated
+ * @param keyLength length of key
+ * @return true on success
+ */
+template <class SerializeableT, std::size_t... Indices>
+bool Serialization::JSONDeserializer::readMember(
+    SerializeableT& object,
+    const char* const key,
+    const std::size_t keyLength,
+    std::index_sequence<Indices...>)
+{
+    using ReadFunction = bool (JSONDeserializer::*)(SerializeableT&);
+    // last entry is taken for unknown keys, as notFound is the descriptor count
+    static constexpr ReadFunction readFunctions[] = {
+        &JSONDeserializer::readMember<SerializeableT, Indices>...,
+        &JSONDeserializer::skipMember<SerializeableT>};
+
+    const std::size_t index = SerializeableT::descriptor.findDescriptor(key, keyLength);
+    return (this->*readFunctions[index])(object);
+}
+
+/**
+ * @brief reads the value of the descriptor at Index.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Index position of the descriptor
+ * @param object object to fill
+ * @return true on success
+ */
+template <class SerializeableT, std::size_t Index>
+bool Serialization::JSONDeserializer::readMember(SerializeableT& object)
+{
+    return readMemberValue(object, Descriptor::getDescriptor<SerializeableT, Index>());
+}
+
+/**
+ * @brief reads the value into the member, const members are skipped.
+ *
+ * @details Described classes start from a copy of the member, so keys
+ * missing in the input keep their value. Everything else is read into
+ * a fresh value, which saves copying containers that get replaced anyway.
+ * With a memory resource the member is read in place, so a member that
+ * fails to read can be left half filled.
+ *
+ * @tparam SerializeableT
+ * @tparam MemberT
+ * @param object object to fill
+ * @param descriptor descriptor of the member
+ * @return true on success
+ */
+template <class SerializeableT, class MemberT>
+bool Serialization::JSONDeserializer::readMemberValue(
+    SerializeableT& object,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    if constexpr (MemberDescriptor<SerializeableT, MemberT>::isWriteable) {
+        using ValueType = typename MemberDescriptor<SerializeableT, MemberT>::ValueType;
+        if (resource != nullptr) {
+            // assigning would copy std::pmr members back to their old resource
+            readValue(object.*descriptor.getMember());
+            return error == DeserializationError::None;
+        }
+        descriptor.readMemberValue(object, [this](ValueType& value) { return readValue(value); });
+    } else {
+        skipValue();
+    }
+    return error == DeserializationError::None;
+}
+
+/**
+ * @brief functions have no value, skipped like unknown keys
+ *
+ * @return true on success
+ */
+template <class SerializeableT, class ReturnT, class... ArgTs>
+bool Serialization::JSONDeserializer::readMemberValue(
+    SerializeableT& object,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return skipValue();
+}
+
+/**
+ * @brief skips the value of an unknown key
+ *
+ * @return true on success
+ */
+template <class SerializeableT>
+bool Serialization::JSONDeserializer::skipMember(SerializeableT& object)
+{
+    return skipValue();
+}
+
+/**
+ * @brief reads a json number without fraction or exponent.
+ *
+ * @tparam IntegerT integral type to read
+ * @param value integer to fill
+ * @return true on success
+ */
+template <class IntegerT>
+bool Serialization::JSONDeserializer::readInteger(IntegerT& value)
+{
+    using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+    bool negative = false;
+    if ((position != end) && (*position == '-')) {
+        if constexpr (!std::is_signed_v<IntegerT>) {
+            return fail(DeserializationError::NumberOutOfRange);
+        }
+        negative = true;
+        ++position;
+    }
+    if ((position == end) || (*position < '0') || (*position > '9') || hasLeadingZero(position)) {
+        return fail(DeserializationError::InvalidNumber);
+    }
+
+    // the magnitude of the minimum is one larger than the maximum
+    const UnsignedT limit = static_cast<UnsignedT>(std::numeric_limits<IntegerT>::max()) + (negative ? 1 : 0);
+    UnsignedT magnitude = 0;
+    while ((position != end) && (*position >= '0') && (*position <= '9')) {
+        const UnsignedT digit = static_cast<UnsignedT>(*position - '0');
+        if (magnitude > (limit - digit) / 10) {
+            return fail(DeserializationError::NumberOutOfRange);
+        }
+        magnitude = magnitude * 10 + digit;
+        ++position;
+    }
+    if ((position != end) && ((*position == '.') || (*position == 'e') || (*position == 'E'))) {
+        return fail(DeserializationError::TypeMismatch);
+    }
+
+    value = negative ? static_cast<IntegerT>(UnsignedT(0) - magnitude) : static_cast<IntegerT>(magnitude);
+    return true;
+}
+
+/**
+ * @brief json numbers start with a single zero or a digit from 1 to 9.
+ *
+ * @param digits first digit of the number, behind the sign
+ * @return true if a zero is followed by another digit, like 007
+ */
+inline bool Serialization::JSONDeserializer::hasLeadingZero(const char* const digits) const
+{
+    return (*digits == '0') && ((digits + 1) != end) && (digits[1] >= '0') && (digits[1] <= '9');
+}
+
+/**
+ * @brief reads the key of an object member.
+ *
+ * @details Keys without escape sequences point into the input,
+ * others are unescaped into keyBuffer.
+ *
+ * @param key set to the key, not zero terminated
+ * @param keyLength set to the length of key
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readKey(const char*& key, std::size_t& keyLength)
+{
+    if ((position == end) || (*position != '"')) {
+        return fail((position == end) ? DeserializationError::UnexpectedEnd : DeserializationError::UnexpectedCharacter);
+    }
+
+    const char* const start = position + 1;
+    for (const char* cursor = start; cursor != end; ++cursor) {
+        if (*cursor == '"') {
+            key = start;
+            keyLength = cursor - start;
+            position = cursor + 1;
+            return true;
+        }
+        if ((*cursor == '\\') || (static_cast<unsigned char>(*cursor) < 0x20)) {
+            break;
+        }
+    }
+
+    key = keyBuffer;
+    return readString(keyBuffer, sizeof(keyBuffer), keyLength);
+}
+
+/**
+ * @brief reads a json string and unescapes it into a buffer.
+ *
+ * @param buffer memory for the unescaped string, not zero terminated
+ * @param capacity size of buffer
+ * @param length set to the number of bytes written to buffer
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readString(char* const buffer, const std::size_t capacity, std::size_t& length)
+{
+    if ((position == end) || (*position != '"')) {
+        return fail((position == end) ? DeserializationError::UnexpectedEnd : DeserializationError::TypeMismatch);
+    }
+    ++position;
+
+    char* output = buffer;
+    char* const outputEnd = buffer + capacity;
+    while (position != end) {
+        const char character = *position;
+        if (character == '"') {
+            ++position;
+            length = output - buffer;
+            return true;
+        }
+        if (static_cast<unsigned char>(character) < 0x20) {
+            return fail(DeserializationError::InvalidString);
+        }
+        if (character == '\\') {
+            ++position;
+            if (!readEscape(output, outputEnd)) {
+                return false;
+            }
+            continue;
+        }
+        if (output == outputEnd) {
+            return fail(DeserializationError::TypeMismatch);
+        }
+        *output++ = character;
+        ++position;
+    }
+    return fail(DeserializationError::UnexpectedEnd);
+}
+
+/**
+ * @brief decodes one escape sequence, position is behind the backslash.
+ *
+ * @details \u escapes are written as UTF-8, including surrogate pairs.
+ *
+ * @param output next position to write to, advanced
+ * @param outputEnd end of the output memory
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readEscape(char*& output, const char* const outputEnd)
+{
+    if (position == end) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+
+    char decoded = 0;
+    switch (*position++) {
+    case '"': decoded = '"'; break;
+    case '\\': decoded = '\\'; break;
+    case '/': decoded = '/'; break;
+    case 'b': decoded = '\b'; break;
+    case 'f': decoded = '\f'; break;
+    case 'n': decoded = '\n'; break;
+    case 'r': decoded = '\r'; break;
+    case 't': decoded = '\t'; break;
+    case 'u': {
+        auto readHex = [this](unsigned long& codePoint) {
+            if (end - position < 4) {
+                return fail(DeserializationError::UnexpectedEnd);
+            }
+            codePoint = 0;
+            for (int ii = 0; ii < 4; ++ii) {
+                const char digit = *position++;
+                codePoint <<= 4;
+                if ((digit >= '0') && (digit <= '9')) {
+                    codePoint |= digit - '0';
+                } else if ((digit >= 'a') && (digit <= 'f')) {
+                    codePoint |= digit - 'a' + 10;
+                } else if ((digit >= 'A') && (digit <= 'F')) {
+                    codePoint |= digit - 'A' + 10;
+                } else {
+                    return fail(DeserializationError::InvalidString);
+                }
+            }
+            return true;
+        };
+
+        unsigned long codePoint = 0;
+        if (!readHex(codePoint)) {
+            return false;
+        }
+        if ((codePoint >= 0xD800) && (codePoint <= 0xDBFF)) {
+            unsigned long low = 0;
+            if ((end - position < 2) || (position[0] != '\\') || (position[1] != 'u')) {
+                return fail(DeserializationError::InvalidString);
+            }
+            position += 2;
+            if (!readHex(low)) {
+                return false;
+            }
+            if ((low < 0xDC00) || (low > 0xDFFF)) {
+                return fail(DeserializationError::InvalidString);
+            }
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        } else if ((codePoint >= 0xDC00) && (codePoint <= 0xDFFF)) {
+            return fail(DeserializationError::InvalidString);
+        }
+
+        char utf8[4];
+        std::size_t utf8Length = 0;
+        if (codePoint < 0x80) {
+            utf8[utf8Length++] = static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            utf8[utf8Length++] = static_cast<char>(0xC0 | (codePoint >> 6));
+            utf8[utf8Length++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            utf8[utf8Length++] = static_cast<char>(0xE0 | (codePoint >> 12));
+            utf8[utf8Length++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8[utf8Length++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            utf8[utf8Length++] = static_cast<char>(0xF0 | (codePoint >> 18));
+            utf8[utf8Length++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            utf8[utf8Length++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8[utf8Length++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        if (static_cast<std::size_t>(outputEnd - output) < utf8Length) {
+            return fail(DeserializationError::TypeMismatch);
+        }
+        std::memcpy(output, utf8, utf8Length);
+        output += utf8Length;
+        return true;
+    }
+    default:
+        return fail(DeserializationError::InvalidString);
+    }
+
+    if (output == outputEnd) {
+        return fail(DeserializationError::TypeMismatch);
+    }
+    *output++ = decoded;
+    return true;
+}
+
+/**
+ * @brief unescapes a json string where it is in the input.
+ *
+ * @details An escape sequence is never shorter than its decoded
+ * characters, so the output can lag behind the position in the same
+ * memory. Runs are only moved once an escape sequence was found, and
+ * the closing quote is always free for a terminating zero.
+ *
+ * @param string set to the first character of the string
+ * @param length set to the unescaped length
+ * @return true on success, fails with UnsupportedType if not in situ
+ */
+inline bool Serialization::JSONDeserializer::readStringInSitu(char*& string, std::size_t& length)
+{
+    if (inSitu == nullptr) {
+        return fail(DeserializationError::UnsupportedType);
+    }
+    if ((position == end) || (*position != '"')) {
+        return fail((position == end) ? DeserializationError::UnexpectedEnd : DeserializationError::TypeMismatch);
+    }
+    ++position;
+
+    string = inSitu + (position - begin);
+    char* output = string;
+    const char* run = position;
+    while (position != end) {
+        const char character = *position;
+        if ((character == '"') || (character == '\\')) {
+            const std::size_t runLength = position - run;
+            if (output != inSitu + (run - begin)) {
+                std::memmove(output, run, runLength);
+            }
+            output += runLength;
+            ++position;
+            if (character == '"') {
+                length = output - string;
+                return true;
+            }
+            if (!readEscape(output, inSitu + (end - begin))) {
+                return false;
+            }
+            run = position;
+            continue;
+        }
+        if (static_cast<unsigned char>(character) < 0x20) {
+            return fail(DeserializationError::InvalidString);
+        }
+        ++position;
+    }
+    return fail(DeserializationError::UnexpectedEnd);
+}
+
+/**
+ * @brief reads a fixed literal like true, false or null.
+ *
+ * @param literal expected characters
+ * @param length length of literal
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::readLiteral(const char* const literal, const std::size_t length)
+{
+    if (static_cast<std::size_t>(end - position) < length) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    if (std::memcmp(position, literal, length) != 0) {
+        return fail(DeserializationError::UnexpectedCharacter);
+    }
+    position += length;
+    return true;
+}
+
+/**
+ * @brief skips any json value, e.g. of an unknown key.
+ *
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::skipValue()
+{
+    if (position == end) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+
+    switch (*position) {
+    case '"':
+        return skipString();
+    case '{':
+    case '[':
+        return skipContainer();
+    case 't':
+        return readLiteral("true", 4);
+    case 'f':
+        return readLiteral("false", 5);
+    case 'n':
+        return readLiteral("null", 4);
+    default:
+        return skipNumber();
+    }
+}
+
+/**
+ * @brief skips a string without unescaping it.
+ *
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::skipString()
+{
+    ++position;
+    while (position != end) {
+        const char character = *position++;
+        if (character == '"') {
+            return true;
+        }
+        if (character == '\\') {
+            if (position == end) {
+                break;
+            }
+            ++position;
+        } else if (static_cast<unsigned char>(character) < 0x20) {
+            return fail(DeserializationError::InvalidString);
+        }
+    }
+    return fail(DeserializationError::UnexpectedEnd);
+}
+
+/**
+ * @brief skips a number including fraction and exponent.
+ *
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::skipNumber()
+{
+    const char* const start = position;
+    if ((position != end) && (*position == '-')) {
+        ++position;
+    }
+    const char* const digits = position;
+    while ((position != end) && (((*position >= '0') && (*position <= '9')) ||
+        (*position == '.') || (*position == 'e') || (*position == 'E') ||
+        (*position == '+') || (*position == '-'))) {
+        ++position;
+    }
+    if ((position == digits) || (position == start)) {
+        return fail(DeserializationError::UnexpectedCharacter);
+    }
+    return true;
+}
+
+/**
+ * @brief skips an object or array including everything nested in it.
+ *
+ * @return true on success
+ */
+inline bool Serialization::JSONDeserializer::skipContainer()
+{
+    const bool isObject = (*position == '{');
+    const char close = isObject ? '}' : ']';
+    if (++depth > maxDepth) {
+        return fail(DeserializationError::TooDeep);
+    }
+    ++position;
+
+    skipWhitespace();
+    if ((position != end) && (*position == close)) {
+        ++position;
+        --depth;
+        return true;
+    }
+
+    for (;;) {
+        if (isObject) {
+            if ((position == end) || (*position != '"')) {
+                return fail((position == end) ? DeserializationError::UnexpectedEnd : DeserializationError::UnexpectedCharacter);
+            }
+            if (!skipString()) {
+                return false;
+            }
+            skipWhitespace();
+            if (!expect(':')) {
+                return false;
+            }
+            skipWhitespace();
+        }
+        if (!skipValue()) {
+            return false;
+        }
+
+        skipWhitespace();
+        if (position == end) {
+            return fail(DeserializationError::UnexpectedEnd);
+        }
+        if (*position == ',') {
+            ++position;
+            skipWhitespace();
+        } else if (*position == close) {
+            ++position;
+            --depth;
+            return true;
+        } else {
+            return fail(DeserializationError::UnexpectedCharacter);
+        }
+    }
+}
+
+inline void Serialization::JSONDeserializer::skipWhitespace()
+{
+    while ((position != end) &&
+        ((*position == ' ') || (*position == '\n') || (*position == '\r') || (*position == '\t'))) {
+        ++position;
+    }
+}
+
+/**
+ * @brief resets the state for a new input, not in situ.
+ *
+ * @param data input
+ * @param size number of bytes in data
+ */
+inline void Serialization::JSONDeserializer::start(const char* const data, const std::size_t size)
+{
+    begin = data;
+    inSitu = nullptr;
+    position = data;
+    end = data + size;
+    depth = 0;
+    error = DeserializationError::None;
+}
+
+/**
+ * @brief consumes the expected character
+ *
+ * @param character character that has to follow
+ * @return true if it was there
+ */
+inline bool Serialization::JSONDeserializer::expect(const char character)
+{
+    if (position == end) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    if (*position != character) {
+        return fail(DeserializationError::UnexpectedCharacter);
+    }
+    ++position;
+    return true;
+}
+
+/**
+ * @brief records the first error
+ *
+ * @param reason what went wrong
+ * @return false, to be returned by the caller
+ */
+inline bool Serialization::JSONDeserializer::fail(const DeserializationError reason)
+{
+    if (error == DeserializationError::None) {
+        error = reason;
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,194 @@
+/**
+ * @file DeserializerJSON.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief automatic json deserializer
+ * @version 1.0
+ * @date 2020-08-03
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __DESERIALIZERJSON_H__
+#define __DESERIALIZERJSON_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class JSONDeserializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Arena.h"
+#include "DeserializationResult.h"
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include "JSONScanner.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "TypeTraits.h"
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief automatic json deserializer
+ *
+ * @details Parses a contiguous buffer in a single pass and writes every
+ * value straight into the object through its MemberDescriptors, without
+ * building a document tree. Unknown keys are skipped, const members are
+ * read but not written, missing members are left untouched.
+ * Errors are returned as DeserializationResult, no exceptions are thrown.
+ * Holds the parse position, so use one instance per thread.
+ *
+ * deserializeInSitu(...) additionally fills std::string_view and
+ * const char* members with strings in the input, unescaped in place,
+ * so reading strings allocates nothing. The input has to outlive the
+ * object, which InSituResult takes care of.
+ *
+ * Given a std::pmr::memory_resource like an Arena, every std::pmr::string
+ * and std::pmr::vector that is filled allocates from it.
+ */
+class JSONDeserializer
+{
+    /** decodes call arguments with the value readers */
+    template <class SerializeableT>
+    friend class CallDispatcher;
+
+    // delete default constructors
+    JSONDeserializer(const JSONDeserializer& other) = delete;
+    JSONDeserializer& operator=(const JSONDeserializer& other) = delete;
+public:
+    /** finds the end of objects in chunked input for IncrementalDeserializer */
+    template <class SerializeableT>
+    using Scanner = JSONScanner;
+
+    JSONDeserializer();
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(const char* const data, const std::size_t size, SerializeableT& object);
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(
+        const char* const data,
+        const std::size_t size,
+        SerializeableT& object,
+        std::pmr::memory_resource& memoryResource);
+
+    template <class SerializeableT>
+    DeserializationResult deserializeInSitu(char* const data, const std::size_t size, SerializeableT& object);
+
+private:
+    /** maximum nesting of objects and arrays */
+    static constexpr std::size_t maxDepth = 64;
+    /** maximum length of a key that contains escape sequences */
+    static constexpr std::size_t maxEscapedKeyLength = 128;
+
+    template <class SerializeableT,
+        typename std::enable_if_t<TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    bool readValue(SerializeableT& object);
+
+    template <class StringT,
+        typename std::enable_if_t<TypeTraits::isString<StringT>, int>  = 0>
+    bool readValue(StringT& value);
+
+    template <class SequenceT,
+        typename std::enable_if_t<TypeTraits::isSequence<SequenceT>, int>  = 0>
+    bool readValue(SequenceT& sequence);
+
+    template <class OptionalT,
+        typename std::enable_if_t<TypeTraits::isOptional<OptionalT>, int>  = 0>
+    bool readValue(OptionalT& optional);
+
+    template <class IntegerT,
+        typename std::enable_if_t<TypeTraits::isInteger<IntegerT>, int>  = 0>
+    bool readValue(IntegerT& value);
+
+    template <class FloatT,
+        typename std::enable_if_t<TypeTraits::isFloatingPoint<FloatT>, int>  = 0>
+    bool readValue(FloatT& value);
+
+    bool readValue(int& value);
+    bool readValue(char& value);
+    bool readValue(bool& value);
+    bool readValue(const char*& value);
+    bool readValue(std::string_view& value);
+
+    template <class SerializeableT>
+    DeserializationResult parse(SerializeableT& object);
+
+    template <class SerializeableT, std::size_t... Indices>
+    bool readMember(
+        SerializeableT& object,
+        const char* const key,
+        const std::size_t keyLength,
+        std::index_sequence<Indices...>);
+
+    template <class SerializeableT, std::size_t Index>
+    bool readMember(SerializeableT& object);
+
+    template <class SerializeableT, class MemberT>
+    bool readMemberValue(
+        SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    bool readMemberValue(
+        SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT>
+    bool skipMember(SerializeableT& object);
+
+    template <class IntegerT>
+    bool readInteger(IntegerT& value);
+    bool hasLeadingZero(const char* const digits) const;
+
+    bool readKey(const char*& key, std::size_t& keyLength);
+    bool readString(char* const buffer, const std::size_t capacity, std::size_t& length);
+    bool readEscape(char*& output, const char* const outputEnd);
+    bool readStringInSitu(char*& string, std::size_t& length);
+    bool readLiteral(const char* const literal, const std::size_t length);
+
+    bool skipValue();
+    bool skipString();
+    bool skipNumber();
+    bool skipContainer();
+    void skipWhitespace();
+
+    void start(const char* const data, const std::size_t size);
+    bool expect(const char character);
+    bool fail(const DeserializationError reason);
+
+    /** start of the input */
+    const char* begin;
+    /** same memory as begin if deserializing in situ, nullptr otherwise */
+    char* inSitu;
+    /** next character to parse */
+    const char* position;
+    /** end of the input */
+    const char* end;
+    /** current nesting of objects and arrays */
+    std::size_t depth;
+    /** resource for std::pmr strings and containers, nullptr to keep theirs */
+    std::pmr::memory_resource* resource;
+    /** first error, None while parsing succeeds */
+    DeserializationError error;
+    /** unescaped copy of a key containing escape sequences */
+    char keyBuffer[maxEscapedKeyLength];
+};
+} // Serialization
+
+// template functions, include src
+#include "DeserializerJSON.cpp"
+#endif //__DESERIALIZERJSON_H__
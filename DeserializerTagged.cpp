@@ -0,0 +1,573 @@
+/**
+ * @file DeserializerTagged.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief reader for the output of TaggedSerializer
+ * @version 1.0
+ * @date 2020-08-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializerTagged.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Serialization::TaggedDeserializer::TaggedDeserializer() :
+    begin(nullptr), position(nullptr), end(nullptr), resource(nullptr), error(DeserializationError::None)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Deserializes the output of TaggedSerializer into an object.
+ *
+ * @details The data can be written for an older or newer descriptor of
+ * the class, only members with the same id are read. The object has no
+ * length of its own, so data cut at a field reads as an object without
+ * the remaining fields. Frame it if that matters, e.g. in a RecordFile.
+ *
+ * @tparam SerializeableT any class with static descriptor and member ids
+ * @param data binary input
+ * @param size number of bytes in data
+ * @param object object to fill, members not in the input keep their value
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::TaggedDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object)
+{
+    static_assert(TypeTraits::isDescribed<SerializeableT>, "the tagged format reads described classes");
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Deserialize, 0);
+    start(data, size);
+    readFields(object);
+    scope.finish(position - begin);
+    return DeserializationResult(error, position - begin);
+}
+
+/**
+ * @brief Deserializes the output of TaggedSerializer, std::pmr strings and containers
+ * allocate from memoryResource.
+ *
+ * @details see JSONDeserializer::deserialize(...) with a memory resource.
+ *
+ * @tparam SerializeableT any class with static descriptor and member ids
+ * @param data binary input
+ * @param size number of bytes in data
+ * @param object object to fill
+ * @param memoryResource resource to allocate from, e.g. an Arena
+ * @return DeserializationResult error and position
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::TaggedDeserializer::deserialize(
+    const char* const data,
+    const std::size_t size,
+    SerializeableT& object,
+    std::pmr::memory_resource& memoryResource)
+{
+    resource = &memoryResource;
+    const DeserializationResult result = deserialize(data, size, object);
+    resource = nullptr;
+    return result;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief reads fields until the end of the current value.
+ *
+ * @details The member of a field is looked up in the fields sorted by id.
+ * The one behind the last member read is tried first, so fields written
+ * in id order are found with a single comparison.
+ *
+ * @tparam SerializeableT any class with static descriptor and member ids
+ * @param object object to fill
+ * @return true on success
+ */
+template <class SerializeableT>
+bool Serialization::TaggedDeserializer::readFields(SerializeableT& object)
+{
+    static_assert(TaggedEncoding::hasValidIds<SerializeableT>(),
+        "every member needs a unique id above 0, e.g. &T::member, \"member\", 1");
+    static constexpr auto fields = TaggedEncoding::makeFieldTable<SerializeableT>();
+
+    std::size_t next = 0;
+    while (position != end) {
+        std::uint32_t id = 0;
+        TaggedEncoding::WireType wireType = TaggedEncoding::WireType::Length;
+        if (!readKey(id, wireType)) {
+            return false;
+        }
+        std::size_t found = next;
+        if ((found >= fields.size()) || (fields[found].id != id)) {
+            found = std::lower_bound(fields.begin(), fields.end(), id,
+                [](const TaggedEncoding::Field& field, const std::uint32_t key) { return field.id < key; }) - fields.begin();
+            if ((found == fields.size()) || (fields[found].id != id)) {
+                // written by a newer descriptor
+                if (!skipField(wireType)) {
+                    return false;
+                }
+                continue;
+            }
+        }
+        if (!readMember(object, fields[found].index, wireType,
+            std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>())) {
+            return false;
+        }
+        next = found + 1;
+    }
+    return true;
+}
+
+/**
+ * @brief reads a field into the member at a descriptor position.
+ *
+ * @details Compiles to a jump over the positions, each reading its
+ * member inline.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @tparam Indices positions of all descriptors
+ * @param object object to fill
+ * @param index position of the member
+ * @param wireType wire type of the field
+ * @return true on success
+ */
+template <class SerializeableT, std::size_t... Indices>
+bool Serialization::TaggedDeserializer::readMember(
+    SerializeableT& object,
+    const std::size_t index,
+    const TaggedEncoding::WireType wireType,
+    std::index_sequence<Indices...>)
+{
+    bool isRead = false;
+    ((index == Indices ?
+        (isRead = readMemberValue(object, Descriptor::getDescriptor<SerializeableT, Indices>(), wireType), true) :
+        false) || ...);
+    return isRead;
+}
+
+/**
+ * @brief reads a field into the member, const members are skipped.
+ *
+ * @tparam SerializeableT
+ * @tparam MemberT
+ * @param object object to fill
+ * @param descriptor descriptor of the member
+ * @param wireType wire type of the field, has to match the member
+ * @return true on success
+ */
+template <class SerializeableT, class MemberT>
+bool Serialization::TaggedDeserializer::readMemberValue(
+    SerializeableT& object,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+    const TaggedEncoding::WireType wireType)
+{
+    using ValueType = typename MemberDescriptor<SerializeableT, MemberT>::ValueType;
+
+    if constexpr (MemberDescriptor<SerializeableT, MemberT>::isWriteable) {
+        if (wireType != TaggedEncoding::wireType<ValueType>()) {
+            return fail(DeserializationError::TypeMismatch);
+        }
+        if (resource != nullptr) {
+            // assigning would copy std::pmr members back to their old resource
+            return readValue(object.*descriptor.getMember());
+        }
+        return descriptor.readMemberValue(object, [this](ValueType& value) { return readValue(value); });
+    } else {
+        return skipField(wireType);
+    }
+}
+
+/**
+ * @brief functions have no field, never called
+ *
+ * @return true if the field can be skipped
+ */
+template <class SerializeableT, class ReturnT, class... ArgTs>
+bool Serialization::TaggedDeserializer::readMemberValue(
+    SerializeableT& object,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+    const TaggedEncoding::WireType wireType)
+{
+    return skipField(wireType);
+}
+
+/**
+ * @brief reads a value behind its key.
+ *
+ * @tparam ValueT any serializeable type
+ * @param value value to fill, a std::optional is emplaced
+ * @return true on success
+ */
+template <class ValueT>
+bool Serialization::TaggedDeserializer::readValue(ValueT& value)
+{
+    if constexpr (TypeTraits::isOptional<ValueT>) {
+        return readValue(value.emplace());
+    } else if constexpr (TaggedEncoding::wireType<ValueT>() == TaggedEncoding::WireType::Length) {
+        return readLengthValue(value);
+    } else {
+        return readFixed(value);
+    }
+}
+
+/**
+ * @brief reads an element of a sequence, std::optional has a presence byte.
+ *
+ * @tparam ElementT any serializeable type
+ * @param element element to fill
+ * @return true on success
+ */
+template <class ElementT>
+bool Serialization::TaggedDeserializer::readElement(ElementT& element)
+{
+    if constexpr (TypeTraits::isOptional<ElementT>) {
+        bool hasValue = false;
+        if (!readFixed(hasValue)) {
+            return false;
+        }
+        if (!hasValue) {
+            element.reset();
+            return true;
+        }
+        return readElement(element.emplace());
+    } else {
+        return readValue(element);
+    }
+}
+
+/**
+ * @brief reads the length and limits the input to it while reading the content.
+ *
+ * @tparam ValueT string, sequence or described class
+ * @param value value to fill
+ * @return true if the content was read and used up the length
+ */
+template <class ValueT>
+bool Serialization::TaggedDeserializer::readLengthValue(ValueT& value)
+{
+    std::size_t length = 0;
+    if (!readLength(length)) {
+        return false;
+    }
+    if (length > static_cast<std::size_t>(end - position)) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    const char* const outerEnd = end;
+    end = position + length;
+    // only a std::array can end before its length, if it got shorter
+    const bool isRead = readContent(value) && ((position == end) || fail(DeserializationError::TypeMismatch));
+    end = outerEnd;
+    return isRead;
+}
+
+template <class SerializeableT,
+    typename std::enable_if_t<Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+bool Serialization::TaggedDeserializer::readContent(SerializeableT& object)
+{
+    return readFields(object);
+}
+
+/**
+ * @brief takes the whole content as string.
+ *
+ * @tparam StringT std::string, std::string_view is not supported
+ * @param value string to fill, previous content is replaced
+ * @return true on success
+ */
+template <class StringT,
+    typename std::enable_if_t<Serialization::TypeTraits::isString<StringT>, int>>
+bool Serialization::TaggedDeserializer::readContent(StringT& value)
+{
+    if constexpr (TypeTraits::isStringView<StringT>) {
+        return fail(DeserializationError::UnsupportedType);
+    } else {
+        Arena::bind(value, resource);
+        value.assign(position, end - position);
+        position = end;
+        return true;
+    }
+}
+
+/**
+ * @brief reads elements until the end of the content.
+ *
+ * @details Elements whose memory equals the encoding are copied
+ * as a whole, others are read one by one.
+ *
+ * @tparam SequenceT std::vector or std::array
+ * @param sequence sequence to fill
+ * @return true on success
+ */
+template <class SequenceT,
+    typename std::enable_if_t<Serialization::TypeTraits::isSequence<SequenceT>, int>>
+bool Serialization::TaggedDeserializer::readContent(SequenceT& sequence)
+{
+    using ElementT = typename SequenceT::value_type;
+    const std::size_t length = end - position;
+    Arena::bind(sequence, resource);
+
+    if constexpr (TypeTraits::isBulkSequence<SequenceT> && BinaryEncoding::isBulkDecodable<ElementT>()) {
+        if constexpr (TypeTraits::isFixedSequence<SequenceT>) {
+            if (length != sizeof(SequenceT)) {
+                return fail(DeserializationError::TypeMismatch);
+            }
+        } else {
+            if (length % sizeof(ElementT) != 0) {
+                return fail(DeserializationError::TypeMismatch);
+            }
+            sequence.resize(length / sizeof(ElementT));
+        }
+        std::memcpy(sequence.data(), position, length);
+        position = end;
+        return true;
+    } else if constexpr (TypeTraits::isFixedSequence<SequenceT>) {
+        for (auto& element : sequence) {
+            if (!readElement(element)) {
+                return false;
+            }
+        }
+        return true;
+    } else {
+        sequence.clear();
+        if constexpr (TaggedEncoding::wireType<ElementT>() != TaggedEncoding::WireType::Length &&
+            !TypeTraits::isOptional<ElementT>) {
+            sequence.reserve(length / TaggedEncoding::fixedSize(TaggedEncoding::wireType<ElementT>()));
+        }
+        while (position != end) {
+            if constexpr (std::uses_allocator_v<ElementT, typename SequenceT::allocator_type>) {
+                // constructed with the allocator of the sequence, e.g. the strings of a std::pmr::vector
+                if (!readElement(sequence.emplace_back())) {
+                    return false;
+                }
+            } else {
+                ElementT element{};
+                if (!readElement(element)) {
+                    return false;
+                }
+                sequence.push_back(std::move(element));
+            }
+        }
+        return true;
+    }
+}
+
+/**
+ * @brief const char* members would point into the input, which is not supported
+ *
+ * @return false
+ */
+inline bool Serialization::TaggedDeserializer::readContent(const char*& value)
+{
+    return fail(DeserializationError::UnsupportedType);
+}
+
+/**
+ * @brief reads a little endian integer of the width of IntegerT.
+ *
+ * @tparam IntegerT integral type except char and bool
+ * @param value integer to fill
+ * @return true on success
+ */
+template <class IntegerT,
+    typename std::enable_if_t<Serialization::TypeTraits::isInteger<IntegerT>, int>>
+bool Serialization::TaggedDeserializer::readFixed(IntegerT& value)
+{
+    using FixedT = TypeTraits::FixedWidthType<IntegerT>;
+
+    const char* bytes = nullptr;
+    if (!take(sizeof(FixedT), bytes)) {
+        return false;
+    }
+    value = static_cast<IntegerT>(BinaryEncoding::read<FixedT>(bytes));
+    return true;
+}
+
+/**
+ * @brief reads the IEEE 754 bits of a float or double.
+ *
+ * @tparam FloatT float or double
+ * @param value floating point to fill
+ * @return true on success
+ */
+template <class FloatT,
+    typename std::enable_if_t<Serialization::TypeTraits::isFloatingPoint<FloatT>, int>>
+bool Serialization::TaggedDeserializer::readFixed(FloatT& value)
+{
+    using BitsT = std::conditional_t<sizeof(FloatT) == 4, std::uint32_t, std::uint64_t>;
+
+    const char* bytes = nullptr;
+    if (!take(sizeof(BitsT), bytes)) {
+        return false;
+    }
+    value = std::bit_cast<FloatT>(BinaryEncoding::read<BitsT>(bytes));
+    return true;
+}
+
+inline bool Serialization::TaggedDeserializer::readFixed(int& value)
+{
+    const char* bytes = nullptr;
+    if (!take(sizeof(BinaryEncoding::IntType), bytes)) {
+        return false;
+    }
+    const BinaryEncoding::IntType decoded = BinaryEncoding::read<BinaryEncoding::IntType>(bytes);
+    if constexpr (sizeof(int) < sizeof(BinaryEncoding::IntType)) {
+        if ((decoded < std::numeric_limits<int>::min()) || (decoded > std::numeric_limits<int>::max())) {
+            return fail(DeserializationError::NumberOutOfRange);
+        }
+    }
+    value = static_cast<int>(decoded);
+    return true;
+}
+
+inline bool Serialization::TaggedDeserializer::readFixed(char& value)
+{
+    const char* bytes = nullptr;
+    if (!take(1, bytes)) {
+        return false;
+    }
+    value = *bytes;
+    return true;
+}
+
+/**
+ * @brief reads a bool, only 0 and 1 are valid.
+ *
+ * @param value bool to fill
+ * @return true on success
+ */
+inline bool Serialization::TaggedDeserializer::readFixed(bool& value)
+{
+    const char* bytes = nullptr;
+    if (!take(1, bytes)) {
+        return false;
+    }
+    if ((*bytes != '\0') && (*bytes != '\1')) {
+        position = bytes;
+        return fail(DeserializationError::TypeMismatch);
+    }
+    value = (*bytes == '\1');
+    return true;
+}
+
+/**
+ * @brief reads the key in front of a field.
+ *
+ * @param id set to the member id
+ * @param wireType set to the wire type, only known ones are accepted
+ * @return true on success
+ */
+inline bool Serialization::TaggedDeserializer::readKey(std::uint32_t& id, TaggedEncoding::WireType& wireType)
+{
+    TaggedEncoding::KeyType key = 0;
+    const std::size_t size = TaggedEncoding::readKey(position, end, key);
+    if (size == 0) {
+        // no last byte within the input or within maxKeySize bytes
+        return fail((static_cast<std::size_t>(end - position) < TaggedEncoding::maxKeySize) ?
+            DeserializationError::UnexpectedEnd : DeserializationError::InvalidNumber);
+    }
+    if ((key & 0x7) > static_cast<TaggedEncoding::KeyType>(TaggedEncoding::WireType::Length)) {
+        // the size of the field is unknown, it can not be skipped
+        return fail(DeserializationError::TypeMismatch);
+    }
+    position += size;
+    id = key >> 3;
+    wireType = static_cast<TaggedEncoding::WireType>(key & 0x7);
+    return true;
+}
+
+/**
+ * @brief skips a field by its wire type, without looking at the value.
+ *
+ * @param wireType wire type of the field
+ * @return true on success
+ */
+inline bool Serialization::TaggedDeserializer::skipField(const TaggedEncoding::WireType wireType)
+{
+    const char* bytes = nullptr;
+    if (wireType == TaggedEncoding::WireType::Length) {
+        std::size_t length = 0;
+        return readLength(length) && take(length, bytes);
+    }
+    return take(TaggedEncoding::fixedSize(wireType), bytes);
+}
+
+/**
+ * @brief reads the length in front of Length values.
+ *
+ * @param length set to the decoded length
+ * @return true on success
+ */
+inline bool Serialization::TaggedDeserializer::readLength(std::size_t& length)
+{
+    const char* bytes = nullptr;
+    if (!take(sizeof(BinaryEncoding::LengthType), bytes)) {
+        return false;
+    }
+    length = BinaryEncoding::read<BinaryEncoding::LengthType>(bytes);
+    return true;
+}
+
+/**
+ * @brief consumes the next bytes of the current value.
+ *
+ * @param size number of bytes needed
+ * @param bytes set to the first byte
+ * @return true if enough input is left
+ */
+inline bool Serialization::TaggedDeserializer::take(const std::size_t size, const char*& bytes)
+{
+    if (static_cast<std::size_t>(end - position) < size) {
+        return fail(DeserializationError::UnexpectedEnd);
+    }
+    bytes = position;
+    position += size;
+    return true;
+}
+
+/**
+ * @brief resets the state for a new input.
+ *
+ * @param data input
+ * @param size number of bytes in data
+ */
+inline void Serialization::TaggedDeserializer::start(const char* const data, const std::size_t size)
+{
+    begin = data;
+    position = data;
+    end = data + size;
+    error = DeserializationError::None;
+}
+
+/**
+ * @brief records the first error
+ *
+ * @param reason what went wrong
+ * @return false, to be returned by the caller
+ */
+inline bool Serialization::TaggedDeserializer::fail(const DeserializationError reason)
+{
+    if (error == DeserializationError::None) {
+        error = reason;
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,157 @@
+/**
+ * @file DeserializerTagged.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief reader for the output of TaggedSerializer
+ * @version 1.0
+ * @date 2020-08-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __DESERIALIZERTAGGED_H__
+#define __DESERIALIZERTAGGED_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class TaggedDeserializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Arena.h"
+#include "BinaryEncoding.h"
+#include "DeserializationResult.h"
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "TaggedEncoding.h"
+#include "TypeTraits.h"
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief reader for the output of TaggedSerializer
+ *
+ * @details Reads fields in any order and finds the member by its id,
+ * expecting the next member in id order first, so input written in
+ * that order takes one comparison per field. Fields with an id the class
+ * does not describe are skipped by their wire type without being decoded,
+ * members without a field in the input keep their value. A field whose
+ * wire type does not match its member is a TypeMismatch. Const members
+ * are skipped. Errors are returned as DeserializationResult, no exceptions
+ * are thrown. Holds the parse position, so use one instance per thread.
+ * Given a std::pmr::memory_resource like an Arena, every std::pmr::string
+ * and std::pmr::vector that is filled allocates from it.
+ */
+class TaggedDeserializer
+{
+    // delete default constructors
+    TaggedDeserializer(const TaggedDeserializer& other) = delete;
+    TaggedDeserializer& operator=(const TaggedDeserializer& other) = delete;
+public:
+    TaggedDeserializer();
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(const char* const data, const std::size_t size, SerializeableT& object);
+
+    template <class SerializeableT>
+    DeserializationResult deserialize(
+        const char* const data,
+        const std::size_t size,
+        SerializeableT& object,
+        std::pmr::memory_resource& memoryResource);
+
+private:
+    template <class SerializeableT>
+    bool readFields(SerializeableT& object);
+
+    template <class SerializeableT, std::size_t... Indices>
+    bool readMember(
+        SerializeableT& object,
+        const std::size_t index,
+        const TaggedEncoding::WireType wireType,
+        std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    bool readMemberValue(
+        SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+        const TaggedEncoding::WireType wireType);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    bool readMemberValue(
+        SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+        const TaggedEncoding::WireType wireType);
+
+    template <class ValueT>
+    bool readValue(ValueT& value);
+
+    template <class ElementT>
+    bool readElement(ElementT& element);
+
+    template <class ValueT>
+    bool readLengthValue(ValueT& value);
+
+    template <class SerializeableT,
+        typename std::enable_if_t<TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    bool readContent(SerializeableT& object);
+
+    template <class StringT,
+        typename std::enable_if_t<TypeTraits::isString<StringT>, int>  = 0>
+    bool readContent(StringT& value);
+
+    template <class SequenceT,
+        typename std::enable_if_t<TypeTraits::isSequence<SequenceT>, int>  = 0>
+    bool readContent(SequenceT& sequence);
+
+    bool readContent(const char*& value);
+
+    template <class IntegerT,
+        typename std::enable_if_t<TypeTraits::isInteger<IntegerT>, int>  = 0>
+    bool readFixed(IntegerT& value);
+
+    template <class FloatT,
+        typename std::enable_if_t<TypeTraits::isFloatingPoint<FloatT>, int>  = 0>
+    bool readFixed(FloatT& value);
+
+    bool readFixed(int& value);
+    bool readFixed(char& value);
+    bool readFixed(bool& value);
+
+    bool readKey(std::uint32_t& id, TaggedEncoding::WireType& wireType);
+    bool skipField(const TaggedEncoding::WireType wireType);
+    bool readLength(std::size_t& length);
+    bool take(const std::size_t size, const char*& bytes);
+    void start(const char* const data, const std::size_t size);
+    bool fail(const DeserializationError reason);
+
+    /** start of the input */
+    const char* begin;
+    /** next byte to read */
+    const char* position;
+    /** end of the value being read, the end of the input at the top level */
+    const char* end;
+    /** resource for std::pmr strings and containers, nullptr to keep theirs */
+    std::pmr::memory_resource* resource;
+    /** first error, None while reading succeeds */
+    DeserializationError error;
+};
+} // Serialization
+
+// template functions, include src
+#include "DeserializerTagged.cpp"
+#endif //__DESERIALIZERTAGGED_H__
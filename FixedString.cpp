@@ -0,0 +1,85 @@
+/**
+ * @file FixedString.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief string with compile time length for constexpr concatenation
+ * @version 1.0
+ * @date 2020-07-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FixedString.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <std::size_t Length>
+constexpr Serialization::FixedString<Length>::FixedString()
+{
+    // do nothing, characters are zero initialized
+}
+
+/**
+ * @brief Construct from the first Length characters of a string.
+ *
+ * @details Length has to be known at compile time already,
+ * for example from Descriptor::getLength(...) or the deduction
+ * guide for string literals.
+ *
+ * @param string string to copy
+ */
+template <std::size_t Length>
+constexpr Serialization::FixedString<Length>::FixedString(const char* const string)
+{
+    for (std::size_t ii = 0; ii < Length; ++ii) {
+        characters[ii] = string[ii];
+    }
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief concatenates two strings
+ *
+ * @tparam OtherLength length of the appended string
+ * @param other string to append
+ * @return constexpr FixedString<Length + OtherLength> concatenated string
+ */
+template <std::size_t Length>
+template <std::size_t OtherLength>
+constexpr Serialization::FixedString<Length + OtherLength>
+    Serialization::FixedString<Length>::operator+(const FixedString<OtherLength>& other) const
+{
+    FixedString<Length + OtherLength> result;
+    for (std::size_t ii = 0; ii < Length; ++ii) {
+        result.characters[ii] = characters[ii];
+    }
+    for (std::size_t ii = 0; ii < OtherLength; ++ii) {
+        result.characters[Length + ii] = other.characters[ii];
+    }
+    return result;
+}
+
+template <std::size_t Length>
+constexpr const char* Serialization::FixedString<Length>::data() const
+{
+    return characters;
+}
+
+template <std::size_t Length>
+constexpr std::size_t Serialization::FixedString<Length>::size() const
+{
+    return Length;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,70 @@
+/**
+ * @file FixedString.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief string with compile time length for constexpr concatenation
+ * @version 1.0
+ * @date 2020-07-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FIXEDSTRING_H__
+#define __FIXEDSTRING_H__
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <std::size_t Length>
+class FixedString;
+}
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief string with compile time length for constexpr concatenation
+ *
+ * @details Used to assemble output fragments (keys, structure documents)
+ * at compile time, so they can be written with one bulk copy.
+ * Always zero terminated.
+ *
+ * @tparam Length number of characters without the terminator
+ */
+template <std::size_t Length>
+class FixedString
+{
+    template <std::size_t OtherLength>
+    friend class FixedString;
+
+public:
+    constexpr explicit FixedString(const char* const string);
+
+    template <std::size_t OtherLength>
+    constexpr FixedString<Length + OtherLength> operator+(const FixedString<OtherLength>& other) const;
+
+    constexpr const char* data() const;
+    constexpr std::size_t size() const;
+
+private:
+    constexpr FixedString();
+
+    /** characters including the zero terminator */
+    char characters[Length + 1] = {};
+};
+
+template <std::size_t LengthWithTerminator>
+FixedString(const char (&string)[LengthWithTerminator]) -> FixedString<LengthWithTerminator - 1>;
+} // Serialization
+
+// template class, include src
+#include "FixedString.cpp"
+#endif //__FIXEDSTRING_H__
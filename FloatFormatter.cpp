@@ -0,0 +1,82 @@
+/**
+ * @file FloatFormatter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief shortest round trip formatting of floating point numbers
+ * @version 1.0
+ * @date 2020-08-12
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FloatFormatter.h"
+#include <charconv>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief formats a floating point number directly into a writer.
+ *
+ * @details Close to the end of the window the value is formatted on the
+ * stack, so a writer sized exactly for the output does not overflow.
+ *
+ * @tparam FloatT float or double
+ * @param writer writer to write to
+ * @param value value to write
+ */
+template <class FloatT>
+void Serialization::FloatFormatter::write(Writer& writer, const FloatT value)
+{
+    if (writer.getAvailable() < maxLength<FloatT>) {
+        char buffer[maxLength<FloatT>];
+        writer.write(buffer, format(buffer, value) - buffer);
+        return;
+    }
+    writer.commit(format(writer.reserve(maxLength<FloatT>), value));
+}
+
+/**
+ * @brief formats a floating point number into memory.
+ *
+ * @details Chooses between fixed and scientific notation,
+ * whichever is shorter, e.g. 0.1, 1e+20 or 1.5e-07.
+ *
+ * @tparam FloatT float or double
+ * @param position memory with at least maxLength<FloatT> bytes
+ * @param value value to write
+ * @return char* one past the last character written
+ */
+template <class FloatT>
+char* Serialization::FloatFormatter::format(char* const position, const FloatT value)
+{
+    static_assert(std::is_floating_point_v<FloatT>, "FloatFormatter only formats floating point numbers");
+    return std::to_chars(position, position + maxLength<FloatT>, value).ptr;
+}
+
+/**
+ * @brief number of characters format(...) writes for a value.
+ *
+ * @tparam FloatT float or double
+ * @param value value to measure
+ * @return std::size_t number of characters
+ */
+template <class FloatT>
+std::size_t Serialization::FloatFormatter::length(const FloatT value)
+{
+    char buffer[maxLength<FloatT>];
+    return format(buffer, value) - buffer;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,68 @@
+/**
+ * @file FloatFormatter.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief shortest round trip formatting of floating point numbers
+ * @version 1.0
+ * @date 2020-08-12
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLOATFORMATTER_H__
+#define __FLOATFORMATTER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class FloatFormatter;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief shortest round trip formatting of floating point numbers
+ *
+ * @details Writes the fewest digits that still parse back to exactly
+ * the same value, using std::to_chars (Ryu in libstdc++), instead of
+ * a fixed precision like std::ostream. Locale free, straight into the
+ * memory of a Writer. Infinity and NaN are written as inf and nan,
+ * formats without them have to check std::isfinite first.
+ */
+class FloatFormatter
+{
+    // delete default constructors
+    FloatFormatter() = delete;
+    FloatFormatter(const FloatFormatter& other) = delete;
+    FloatFormatter& operator=(const FloatFormatter& other) = delete;
+public:
+    /** maximum number of characters: sign, digits, point and exponent like e-308 */
+    template <class FloatT>
+    static constexpr std::size_t maxLength = std::numeric_limits<FloatT>::max_digits10 + 7;
+
+    template <class FloatT>
+    static void write(Writer& writer, const FloatT value);
+
+    template <class FloatT>
+    static char* format(char* const position, const FloatT value);
+
+    template <class FloatT>
+    static std::size_t length(const FloatT value);
+};
+} // Serialization
+
+// template functions, include src
+#include "FloatFormatter.cpp"
+#endif //__FLOATFORMATTER_H__
@@ -0,0 +1,102 @@
+/**
+ * @file InSituResult.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief object deserialized in situ together with its input
+ * @version 1.0
+ * @date 2020-08-14
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __INSITURESULT_H__
+#define __INSITURESULT_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializeableT>
+class InSituResult;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializationResult.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief object deserialized in situ together with its input
+ *
+ * @details Takes over the input buffer and deserializes the object
+ * from it with deserializeInSitu(...) of any deserializer. std::string_view
+ * and const char* members point into the buffer, owning both keeps them
+ * valid as long as the result lives. Moving keeps the memory of the buffer,
+ * copies are not possible as the copied views would point into the original.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ */
+template <class SerializeableT>
+class InSituResult
+{
+    // delete default constructors
+    InSituResult() = delete;
+    InSituResult(const InSituResult& other) = delete;
+    InSituResult& operator=(const InSituResult& other) = delete;
+public:
+    InSituResult(InSituResult&& other) = default;
+    InSituResult& operator=(InSituResult&& other) = default;
+
+    /**
+     * @brief deserializes the object from the buffer
+     *
+     * @tparam DeserializerT JSONDeserializer or BinaryDeserializer
+     * @param buffer input, taken over and modified
+     * @param deserializer deserializer to read with
+     */
+    template <class DeserializerT>
+    InSituResult(std::vector<char>&& buffer, DeserializerT& deserializer) :
+        buffer(std::move(buffer)),
+        object(),
+        result(deserializer.deserializeInSitu(this->buffer.data(), this->buffer.size(), object))
+    {
+    }
+
+    SerializeableT& getObject()
+    {
+        return object;
+    }
+
+    const SerializeableT& getObject() const
+    {
+        return object;
+    }
+
+    const DeserializationResult& getResult() const
+    {
+        return result;
+    }
+
+    explicit operator bool() const
+    {
+        return static_cast<bool>(result);
+    }
+
+private:
+    /** input the views of object point into */
+    std::vector<char> buffer;
+    /** deserialized object */
+    SerializeableT object;
+    /** error and position of the deserialization */
+    DeserializationResult result;
+};
+} // Serialization
+#endif //__INSITURESULT_H__
@@ -0,0 +1,137 @@
+/**
+ * @file IncrementalDeserializer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief push style deserialization of objects arriving in chunks
+ * @version 1.0
+ * @date 2020-08-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "IncrementalDeserializer.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class SerializeableT, class DeserializerT>
+Serialization::IncrementalDeserializer<SerializeableT, DeserializerT>::IncrementalDeserializer() :
+    deserializer(), scanner(), pending(), position(0), error(DeserializationError::None)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Takes the next chunk of the input.
+ *
+ * @details Calls onObject(SerializeableT&) for every object completed by
+ * this chunk, in order. Each object is default constructed, so members
+ * missing in the input keep their default.
+ *
+ * @tparam CallbackT callable with SerializeableT&
+ * @param data next chunk of the input
+ * @param size number of bytes in data
+ * @param onObject called with every completed object
+ * @return DeserializationResult error and position in the stream,
+ * the error stays until reset()
+ */
+template <class SerializeableT, class DeserializerT>
+template <class CallbackT>
+Serialization::DeserializationResult Serialization::IncrementalDeserializer<SerializeableT, DeserializerT>::push(
+    const char* const data,
+    const std::size_t size,
+    CallbackT&& onObject)
+{
+    std::size_t offset = 0;
+    while ((error == DeserializationError::None) && (offset != size)) {
+        const std::size_t scanned = scanner.scan(data + offset, size - offset);
+        if (scanner.getError() != DeserializationError::None) {
+            error = scanner.getError();
+            position += scanned;
+            break;
+        }
+        if (!scanner.isComplete()) {
+            // whitespace between objects is not kept
+            if (scanner.isStarted()) {
+                pending.insert(pending.end(), data + offset, data + size);
+            }
+            position += size - offset;
+            break;
+        }
+
+        position += scanned;
+        if (pending.empty()) {
+            emit(data + offset, scanned, onObject);
+        } else {
+            pending.insert(pending.end(), data + offset, data + offset + scanned);
+            emit(pending.data(), pending.size(), onObject);
+            pending.clear();
+        }
+        offset += scanned;
+        scanner.reset();
+    }
+    return DeserializationResult(error, position);
+}
+
+/**
+ * @brief checks if the stream stopped in the middle of an object
+ *
+ * @return true if bytes of an incomplete object are buffered
+ */
+template <class SerializeableT, class DeserializerT>
+bool Serialization::IncrementalDeserializer<SerializeableT, DeserializerT>::hasPartialObject() const
+{
+    return !pending.empty();
+}
+
+/**
+ * @brief starts a new stream, buffers keep their memory
+ */
+template <class SerializeableT, class DeserializerT>
+void Serialization::IncrementalDeserializer<SerializeableT, DeserializerT>::reset()
+{
+    scanner.reset();
+    pending.clear();
+    position = 0;
+    error = DeserializationError::None;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief reads a complete object and hands it to the callback.
+ *
+ * @tparam CallbackT callable with SerializeableT&
+ * @param data bytes of exactly one object
+ * @param size number of bytes in data
+ * @param onObject called with the object
+ * @return true on success
+ */
+template <class SerializeableT, class DeserializerT>
+template <class CallbackT>
+bool Serialization::IncrementalDeserializer<SerializeableT, DeserializerT>::emit(
+    const char* const data,
+    const std::size_t size,
+    CallbackT& onObject)
+{
+    SerializeableT object{};
+    const DeserializationResult result = deserializer.deserialize(data, size, object);
+    if (!result) {
+        // position is behind the object, move it to the rejected byte
+        error = result.getError();
+        position -= size - result.getPosition();
+        return false;
+    }
+    onObject(object);
+    return true;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
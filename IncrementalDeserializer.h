@@ -0,0 +1,84 @@
+/**
+ * @file IncrementalDeserializer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief push style deserialization of objects arriving in chunks
+ * @version 1.0
+ * @date 2020-08-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __INCREMENTALDESERIALIZER_H__
+#define __INCREMENTALDESERIALIZER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializeableT, class DeserializerT>
+class IncrementalDeserializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializationResult.h"
+#include <cstddef>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief push style deserialization of objects arriving in chunks
+ *
+ * @details Takes the input in chunks of any size, e.g. as read from a
+ * pipe or socket, and calls back with every completed object. The
+ * scanner of the format (DeserializerT::Scanner) keeps its position
+ * between chunks and finds where an object ends, which is then read by
+ * DeserializerT in one go. Objects lying completely inside of a chunk are
+ * read from the chunk itself, only the start of an object that continues
+ * in the next chunk is copied. Every byte is scanned and read once, no
+ * matter how the input is split. Use one instance per stream.
+ *
+ * @tparam SerializeableT default constructible class with static descriptor
+ * @tparam DeserializerT JSONDeserializer or BinaryDeserializer
+ */
+template <class SerializeableT, class DeserializerT>
+class IncrementalDeserializer
+{
+    // delete default constructors
+    IncrementalDeserializer(const IncrementalDeserializer& other) = delete;
+    IncrementalDeserializer& operator=(const IncrementalDeserializer& other) = delete;
+public:
+    IncrementalDeserializer();
+
+    template <class CallbackT>
+    DeserializationResult push(const char* const data, const std::size_t size, CallbackT&& onObject);
+
+    bool hasPartialObject() const;
+    void reset();
+
+private:
+    template <class CallbackT>
+    bool emit(const char* const data, const std::size_t size, CallbackT& onObject);
+
+    /** reads completed objects */
+    DeserializerT deserializer;
+    /** finds the end of the current object */
+    typename DeserializerT::template Scanner<SerializeableT> scanner;
+    /** start of an object continued in the next chunk */
+    std::vector<char> pending;
+    /** bytes of the stream consumed */
+    std::size_t position;
+    /** first error, pushing does nothing after it until reset() */
+    DeserializationError error;
+};
+} // Serialization
+
+// template class, include src
+#include "IncrementalDeserializer.cpp"
+#endif //__INCREMENTALDESERIALIZER_H__
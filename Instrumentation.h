@@ -0,0 +1,100 @@
+/**
+ * @file Instrumentation.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compile time selection of the serialization instrumentation
+ * @version 1.0
+ * @date 2020-09-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __INSTRUMENTATION_H__
+#define __INSTRUMENTATION_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+enum class InstrumentedOperation;
+class NoInstrumentation;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+/**
+ * @brief calls of the serializers and deserializers that are instrumented
+ */
+enum class InstrumentedOperation
+{
+    Serialize,
+    SerializeStructure,
+    Deserialize
+};
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief instrumentation that does nothing
+ *
+ * @details Used unless SERIALIZATION_INSTRUMENTATION is defined. The
+ * scope is empty and all its functions are constexpr and empty, so the
+ * hooks in the serializers compile to nothing.
+ */
+class NoInstrumentation
+{
+    // delete default constructors
+    NoInstrumentation() = delete;
+    NoInstrumentation(const NoInstrumentation& other) = delete;
+    NoInstrumentation& operator=(const NoInstrumentation& other) = delete;
+public:
+    /** whether anything is recorded */
+    static constexpr bool isEnabled = false;
+
+    /**
+     * @brief measures nothing
+     *
+     * @tparam SerializeableT any class with static descriptor
+     */
+    template <class SerializeableT>
+    class Scope
+    {
+        // delete default constructors
+        Scope(const Scope& other) = delete;
+        Scope& operator=(const Scope& other) = delete;
+    public:
+        constexpr Scope(const InstrumentedOperation operation, const std::size_t position)
+        {
+        }
+
+        constexpr void finish(const std::size_t position, const std::size_t calls = 1)
+        {
+        }
+    };
+};
+} // Serialization
+
+#ifdef SERIALIZATION_INSTRUMENTATION
+#include "TypeInstrumentation.h"
+#endif
+
+namespace Serialization
+{
+/**
+ * instrumentation of all serializers and deserializers, define
+ * SERIALIZATION_INSTRUMENTATION in every translation unit to record
+ * calls, bytes and latencies per type with TypeInstrumentation
+ */
+#ifdef SERIALIZATION_INSTRUMENTATION
+using Instrumentation = TypeInstrumentation;
+#else
+using Instrumentation = NoInstrumentation;
+#endif
+} // Serialization
+#endif //__INSTRUMENTATION_H__
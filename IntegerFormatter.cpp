@@ -0,0 +1,153 @@
+/**
+ * @file IntegerFormatter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief locale free decimal formatting of integers
+ * @version 1.0
+ * @date 2020-07-30
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "IntegerFormatter.h"
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief formats an integer directly into a writer.
+ *
+ * @details Close to the end of the window the value is formatted on the
+ * stack, so a writer sized exactly for the output does not overflow.
+ *
+ * @tparam IntegerT any integral type except bool
+ * @param writer writer to write to
+ * @param value value to write
+ */
+template <class IntegerT>
+void Serialization::IntegerFormatter::write(Writer& writer, const IntegerT value)
+{
+    if (writer.getAvailable() < maxLength<IntegerT>) {
+        char buffer[maxLength<IntegerT>];
+        writer.write(buffer, format(buffer, value) - buffer);
+        return;
+    }
+    writer.commit(format(writer.reserve(maxLength<IntegerT>), value));
+}
+
+/**
+ * @brief formats an integer into memory.
+ *
+ * @tparam IntegerT any integral type except bool
+ * @param position memory with at least maxLength<IntegerT> bytes
+ * @param value value to write
+ * @return char* one past the last character written
+ */
+template <class IntegerT>
+char* Serialization::IntegerFormatter::format(char* const position, const IntegerT value)
+{
+    static_assert(std::is_integral_v<IntegerT> && !std::is_same_v<bool, IntegerT>,
+        "IntegerFormatter only formats integers");
+    using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+    if constexpr (std::is_signed_v<IntegerT>) {
+        if (value < 0) {
+            *position = '-';
+            // negate in unsigned arithmetic, so the minimum does not overflow
+            return formatUnsigned(position + 1, static_cast<UnsignedT>(UnsignedT(0) - static_cast<UnsignedT>(value)));
+        }
+    }
+    return formatUnsigned(position, static_cast<UnsignedT>(value));
+}
+
+/**
+ * @brief counts the decimal digits of a number.
+ *
+ * @tparam UnsignedT unsigned integral type
+ * @param value number to count the digits of
+ * @return std::size_t number of digits, 1 for 0
+ */
+template <class UnsignedT>
+std::size_t Serialization::IntegerFormatter::countDigits(UnsignedT value)
+{
+    std::size_t digits = 1;
+    for (;;) {
+        if (value < 10) {
+            return digits;
+        }
+        if (value < 100) {
+            return digits + 1;
+        }
+        if (value < 1000) {
+            return digits + 2;
+        }
+        if (value < 10000) {
+            return digits + 3;
+        }
+        value /= 10000;
+        digits += 4;
+    }
+}
+
+/**
+ * @brief number of characters format(...) writes for a value.
+ *
+ * @tparam IntegerT any integral type except bool
+ * @param value value to measure
+ * @return std::size_t digits including the sign
+ */
+template <class IntegerT>
+std::size_t Serialization::IntegerFormatter::length(const IntegerT value)
+{
+    using UnsignedT = std::make_unsigned_t<IntegerT>;
+
+    if constexpr (std::is_signed_v<IntegerT>) {
+        if (value < 0) {
+            return 1 + countDigits(static_cast<UnsignedT>(UnsignedT(0) - static_cast<UnsignedT>(value)));
+        }
+    }
+    return countDigits(static_cast<UnsignedT>(value));
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief writes the digits back to front, two at a time.
+ *
+ * @tparam UnsignedT unsigned integral type
+ * @param position memory to write to
+ * @param value value to write
+ * @return char* one past the last character written
+ */
+template <class UnsignedT>
+char* Serialization::IntegerFormatter::formatUnsigned(char* const position, UnsignedT value)
+{
+    char* const end = position + countDigits(value);
+    char* cursor = end;
+
+    while (value >= 100) {
+        const std::size_t index = static_cast<std::size_t>(value % 100) * 2;
+        value /= 100;
+        cursor -= 2;
+        std::memcpy(cursor, &digitPairs[index], 2);
+    }
+
+    if (value >= 10) {
+        std::memcpy(cursor - 2, &digitPairs[static_cast<std::size_t>(value) * 2], 2);
+    } else {
+        *(cursor - 1) = static_cast<char>('0' + value);
+    }
+    return end;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,85 @@
+/**
+ * @file IntegerFormatter.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief locale free decimal formatting of integers
+ * @version 1.0
+ * @date 2020-07-30
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __INTEGERFORMATTER_H__
+#define __INTEGERFORMATTER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class IntegerFormatter;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief locale free decimal formatting of integers
+ *
+ * @details Writes two digits per division using a lookup table,
+ * straight into the memory of a Writer. Can be used by any format.
+ */
+class IntegerFormatter
+{
+    // delete default constructors
+    IntegerFormatter() = delete;
+    IntegerFormatter(const IntegerFormatter& other) = delete;
+    IntegerFormatter& operator=(const IntegerFormatter& other) = delete;
+public:
+    /** maximum number of characters of IntegerT, including the sign */
+    template <class IntegerT>
+    static constexpr std::size_t maxLength = std::numeric_limits<IntegerT>::digits10 + 2;
+
+    template <class IntegerT>
+    static void write(Writer& writer, const IntegerT value);
+
+    template <class IntegerT>
+    static char* format(char* const position, const IntegerT value);
+
+    template <class UnsignedT>
+    static std::size_t countDigits(UnsignedT value);
+
+    template <class IntegerT>
+    static std::size_t length(const IntegerT value);
+
+private:
+    template <class UnsignedT>
+    static char* formatUnsigned(char* const position, UnsignedT value);
+
+    /** "00" to "99" */
+    static constexpr char digitPairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+};
+} // Serialization
+
+// template functions, include src
+#include "IntegerFormatter.cpp"
+#endif //__INTEGERFORMATTER_H__
@@ -0,0 +1,277 @@
+/**
+ * @file JSONEscaper.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief escaping of strings for json output
+ * @version 1.0
+ * @date 2020-07-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "JSONEscaper.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SERIALIZATION_X86
+#endif
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief writes the escaped content of a string, without quotes.
+ *
+ * @param writer writer to write to
+ * @param string string to escape
+ * @param length number of characters in string
+ */
+inline void Serialization::JSONEscaper::write(Writer& writer, const char* const string, const std::size_t length)
+{
+    const FindFunction findEscape = getFindFunction();
+
+    const char* const end = string + length;
+    const char* runStart = string;
+    while (runStart != end) {
+        const char* const position = findEscape(runStart, end);
+        writer.write(runStart, position - runStart);
+        if (position == end) {
+            break;
+        }
+        write(writer, *position);
+        runStart = position + 1;
+    }
+}
+
+/**
+ * @brief writes a single character, escaped if needed.
+ *
+ * @param writer writer to write to
+ * @param character character to write
+ */
+inline void Serialization::JSONEscaper::write(Writer& writer, const char character)
+{
+    switch (character) {
+    case '"':
+        writer.write("\\\"", 2);
+        break;
+    case '\\':
+        writer.write("\\\\", 2);
+        break;
+    case '\b':
+        writer.write("\\b", 2);
+        break;
+    case '\f':
+        writer.write("\\f", 2);
+        break;
+    case '\n':
+        writer.write("\\n", 2);
+        break;
+    case '\r':
+        writer.write("\\r", 2);
+        break;
+    case '\t':
+        writer.write("\\t", 2);
+        break;
+    default:
+        if (needsEscape(character)) {
+            constexpr const char* hex = "0123456789abcdef";
+            const char escaped[6] = {
+                '\\', 'u', '0', '0',
+                hex[(static_cast<unsigned char>(character) >> 4) & 0xF],
+                hex[static_cast<unsigned char>(character) & 0xF]};
+            writer.write(escaped, sizeof(escaped));
+        } else {
+            writer.write(character);
+        }
+        break;
+    }
+}
+
+/**
+ * @brief number of characters write(...) produces for a string, without quotes.
+ *
+ * @details Uses the same search as write(...), so runs without
+ * anything to escape are only counted.
+ *
+ * @param string string to measure
+ * @param length number of characters in string
+ * @return std::size_t length of the escaped string
+ */
+inline std::size_t Serialization::JSONEscaper::escapedLength(const char* const string, const std::size_t length)
+{
+    const FindFunction findEscape = getFindFunction();
+
+    const char* const end = string + length;
+    std::size_t escaped = length;
+    const char* position = findEscape(string, end);
+    while (position != end) {
+        escaped += escapedLength(*position) - 1;
+        position = findEscape(position + 1, end);
+    }
+    return escaped;
+}
+
+/**
+ * @brief number of characters write(...) produces for a single character.
+ *
+ * @param character character to measure
+ * @return std::size_t 1, 2 for short escapes or 6 for \u00XX
+ */
+inline std::size_t Serialization::JSONEscaper::escapedLength(const char character)
+{
+    switch (character) {
+    case '"':
+    case '\\':
+    case '\b':
+    case '\f':
+    case '\n':
+    case '\r':
+    case '\t':
+        return 2;
+    default:
+        return needsEscape(character) ? 6 : 1;
+    }
+}
+
+/**
+ * @brief checks if json requires the character to be escaped
+ *
+ * @param character character to check
+ * @return true for quote, backslash and control characters
+ */
+inline bool Serialization::JSONEscaper::needsEscape(const char character)
+{
+    const unsigned char value = static_cast<unsigned char>(character);
+    return (value < 0x20) || (value == '"') || (value == '\\');
+}
+
+/**
+ * @brief finds the next character that needs escaping, byte by byte.
+ *
+ * @param position first character to check
+ * @param end end of the string
+ * @return const char* position of the character or end
+ */
+inline const char* Serialization::JSONEscaper::findEscapeScalar(const char* position, const char* const end)
+{
+    while ((position != end) && !needsEscape(*position)) {
+        ++position;
+    }
+    return position;
+}
+
+/**
+ * @brief finds the next character that needs escaping, 16 bytes at a time.
+ *
+ * @param position first character to check
+ * @param end end of the string
+ * @return const char* position of the character or end
+ */
+#if defined(SERIALIZATION_X86)
+__attribute__((target("sse2")))
+inline const char* Serialization::JSONEscaper::findEscapeSSE2(const char* position, const char* const end)
+{
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i lastControl = _mm_set1_epi8(0x1F);
+
+    while (end - position >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+        // unsigned chunk <= 0x1F, signed compare would also hit bytes >= 0x80
+        const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chunk, lastControl), chunk);
+        const __m128i hits = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+            control);
+        const int mask = _mm_movemask_epi8(hits);
+        if (mask != 0) {
+            return position + __builtin_ctz(static_cast<unsigned int>(mask));
+        }
+        position += 16;
+    }
+    return findEscapeScalar(position, end);
+}
+#else
+inline const char* Serialization::JSONEscaper::findEscapeSSE2(const char* position, const char* const end)
+{
+    return findEscapeScalar(position, end);
+}
+#endif
+
+/**
+ * @brief finds the next character that needs escaping, 32 bytes at a time.
+ *
+ * @details only call if the CPU supports AVX2, see getFindFunction()
+ *
+ * @param position first character to check
+ * @param end end of the string
+ * @return const char* position of the character or end
+ */
+#if defined(SERIALIZATION_X86)
+__attribute__((target("avx2")))
+inline const char* Serialization::JSONEscaper::findEscapeAVX2(const char* position, const char* const end)
+{
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i lastControl = _mm256_set1_epi8(0x1F);
+
+    while (end - position >= 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(position));
+        const __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, lastControl), chunk);
+        const __m256i hits = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)),
+            control);
+        const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(hits));
+        if (mask != 0) {
+            return position + __builtin_ctz(mask);
+        }
+        position += 32;
+    }
+    return findEscapeSSE2(position, end);
+}
+#else
+inline const char* Serialization::JSONEscaper::findEscapeAVX2(const char* position, const char* const end)
+{
+    return findEscapeScalar(position, end);
+}
+#endif
+
+/**
+ * @brief gets the fastest search supported by this CPU.
+ *
+ * @return FindFunction search function
+ */
+inline Serialization::JSONEscaper::FindFunction Serialization::JSONEscaper::getFindFunction()
+{
+    static const FindFunction findFunction = selectFindFunction();
+    return findFunction;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+inline Serialization::JSONEscaper::FindFunction Serialization::JSONEscaper::selectFindFunction()
+{
+#if defined(SERIALIZATION_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &findEscapeAVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return &findEscapeSSE2;
+    }
+#endif
+    return &findEscapeScalar;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+#undef SERIALIZATION_X86
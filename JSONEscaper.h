@@ -0,0 +1,73 @@
+/**
+ * @file JSONEscaper.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief escaping of strings for json output
+ * @version 1.0
+ * @date 2020-07-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __JSONESCAPER_H__
+#define __JSONESCAPER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class JSONEscaper;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstddef>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief escaping of strings for json output
+ *
+ * @details Quotes, backslashes and control characters are escaped,
+ * everything else is copied unchanged. Runs without anything to escape
+ * are found 16 (SSE2) or 32 (AVX2) bytes at a time and copied in bulk.
+ * The implementation is chosen once at runtime by the CPU features,
+ * falling back to scalar code on other architectures.
+ */
+class JSONEscaper
+{
+    // delete default constructors
+    JSONEscaper() = delete;
+    JSONEscaper(const JSONEscaper& other) = delete;
+    JSONEscaper& operator=(const JSONEscaper& other) = delete;
+public:
+    static void write(Writer& writer, const char* const string, const std::size_t length);
+    static void write(Writer& writer, const char character);
+
+    static std::size_t escapedLength(const char* const string, const std::size_t length);
+    static std::size_t escapedLength(const char character);
+
+    static bool needsEscape(const char character);
+
+    /** signature of a search for the next character that needs escaping */
+    using FindFunction = const char* (*)(const char* position, const char* const end);
+
+    static const char* findEscapeScalar(const char* position, const char* const end);
+    static const char* findEscapeSSE2(const char* position, const char* const end);
+    static const char* findEscapeAVX2(const char* position, const char* const end);
+
+    static FindFunction getFindFunction();
+
+private:
+    static FindFunction selectFindFunction();
+};
+} // Serialization
+
+// include src
+#include "JSONEscaper.cpp"
+#endif //__JSONESCAPER_H__
@@ -0,0 +1,138 @@
+/**
+ * @file JSONScanner.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief finds the end of json objects in chunked input
+ * @version 1.0
+ * @date 2020-08-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "JSONScanner.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Serialization::JSONScanner::JSONScanner() :
+    depth(0), inString(false), escaped(false), complete(false), error(DeserializationError::None)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief scans the next chunk of the current object.
+ *
+ * @details Stops behind the closing bracket of the object, whitespace
+ * in front of it is part of the object. Outside of the object only
+ * whitespace and the opening bracket are accepted.
+ *
+ * @param data next chunk of the input
+ * @param size number of bytes in data
+ * @return std::size_t number of bytes belonging to the object, all of
+ * them if it is not complete yet
+ */
+inline std::size_t Serialization::JSONScanner::scan(const char* const data, const std::size_t size)
+{
+    const char* const end = data + size;
+    for (const char* position = data; position != end; ++position) {
+        const char character = *position;
+        if (inString) {
+            if (escaped) {
+                escaped = false;
+            } else if (character == '\\') {
+                escaped = true;
+            } else if (character == '"') {
+                inString = false;
+            }
+            continue;
+        }
+
+        switch (character) {
+        case ' ':
+        case '\n':
+        case '\r':
+        case '\t':
+            break;
+        case '{':
+            ++depth;
+            break;
+        case '[':
+        case '"':
+            if (depth == 0) {
+                error = DeserializationError::UnexpectedCharacter;
+                return position - data;
+            }
+            inString = (character == '"');
+            depth += inString ? 0 : 1;
+            break;
+        case '}':
+        case ']':
+            if (depth == 0) {
+                error = DeserializationError::UnexpectedCharacter;
+                return position - data;
+            }
+            if (--depth == 0) {
+                complete = true;
+                return position + 1 - data;
+            }
+            break;
+        default:
+            if (depth == 0) {
+                error = DeserializationError::UnexpectedCharacter;
+                return position - data;
+            }
+            break;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief checks if the opening bracket of the object was scanned
+ *
+ * @return true if more than whitespace was scanned
+ */
+inline bool Serialization::JSONScanner::isStarted() const
+{
+    return (depth != 0) || complete;
+}
+
+/**
+ * @brief checks if the end of the object was found
+ *
+ * @return true if the object is complete
+ */
+inline bool Serialization::JSONScanner::isComplete() const
+{
+    return complete;
+}
+
+inline Serialization::DeserializationError Serialization::JSONScanner::getError() const
+{
+    return error;
+}
+
+/**
+ * @brief starts scanning the next object
+ */
+inline void Serialization::JSONScanner::reset()
+{
+    depth = 0;
+    inString = false;
+    escaped = false;
+    complete = false;
+    error = DeserializationError::None;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,68 @@
+/**
+ * @file JSONScanner.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief finds the end of json objects in chunked input
+ * @version 1.0
+ * @date 2020-08-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __JSONSCANNER_H__
+#define __JSONSCANNER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class JSONScanner;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializationResult.h"
+#include <cstddef>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief finds the end of json objects in chunked input
+ *
+ * @details Tracks nesting and strings byte by byte, so an object can be
+ * split anywhere between calls of scan(...). Whether the content is
+ * valid json is left to JSONDeserializer. Used by IncrementalDeserializer.
+ */
+class JSONScanner
+{
+public:
+    JSONScanner();
+
+    std::size_t scan(const char* const data, const std::size_t size);
+
+    bool isStarted() const;
+    bool isComplete() const;
+    DeserializationError getError() const;
+    void reset();
+
+private:
+    /** nesting of objects and arrays, 0 outside of the object */
+    std::size_t depth;
+    /** inside of a string */
+    bool inString;
+    /** behind a backslash in a string */
+    bool escaped;
+    /** the closing bracket of the object was scanned */
+    bool complete;
+    /** first error, None while scanning succeeds */
+    DeserializationError error;
+};
+} // Serialization
+
+// include src
+#include "JSONScanner.cpp"
+#endif //__JSONSCANNER_H__
@@ -12,6 +12,7 @@
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "MemberDescriptor.h"
+#include <utility>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -19,7 +20,8 @@
 
 template <class SerializeableT, class MemberT>
 constexpr Serialization::MemberDescriptor<SerializeableT, MemberT>::MemberDescriptor(
-    const MemberT SerializeableT::*member, const char* const name) : member(member), name(name)
+    MemberT SerializeableT::*member, const char* const name, const std::uint32_t id) :
+    member(member), name(name), id(id)
 {
 }
 
@@ -28,16 +30,50 @@ constexpr Serialization::MemberDescriptor<SerializeableT, MemberT>::MemberDescri
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
 
 template <class SerializeableT, class MemberT>
-constexpr MemberT Serialization::MemberDescriptor<SerializeableT, MemberT>::getMemberValue(const SerializeableT& object) const
+constexpr const typename Serialization::MemberDescriptor<SerializeableT, MemberT>::ValueType&
+    Serialization::MemberDescriptor<SerializeableT, MemberT>::getMemberValue(const SerializeableT& object) const
 {
     return object.*member;
 }
 
 template <class SerializeableT, class MemberT>
-constexpr void Serialization::MemberDescriptor<SerializeableT, MemberT>::setMemberValue(SerializeableT& object, MemberT value) const
+constexpr void Serialization::MemberDescriptor<SerializeableT, MemberT>::setMemberValue(SerializeableT& object, ValueType value) const
 {
-    object.*member = value;
-} 
+    static_assert(isWriteable, "const members can not be set");
+    object.*member = std::move(value);
+}
+
+/**
+ * @brief reads the member with a deserializer, shared by all of them.
+ *
+ * @details Nested classes are read in place, so members missing in the
+ * input keep their value and nothing is copied. Everything else is read
+ * into a fresh value and only assigned on success, containers would
+ * otherwise be appended to.
+ *
+ * @tparam ReadValueT callable taking ValueType& and returning true on success
+ * @param object object to fill
+ * @param readValue reads a value from the input
+ * @return result of readValue
+ */
+template <class SerializeableT, class MemberT>
+template <class ReadValueT>
+constexpr bool Serialization::MemberDescriptor<SerializeableT, MemberT>::readMemberValue(
+    SerializeableT& object,
+    ReadValueT&& readValue) const
+{
+    static_assert(isWriteable, "const members can not be read");
+    if constexpr (TypeTraits::isDescribed<ValueType>) {
+        return readValue(object.*member);
+    } else {
+        ValueType value{};
+        if (!readValue(value)) {
+            return false;
+        }
+        object.*member = std::move(value);
+        return true;
+    }
+}
 
 template <class SerializeableT, class MemberT>
 constexpr const char* const Serialization::MemberDescriptor<SerializeableT, MemberT>::getName() const
@@ -45,6 +81,18 @@ constexpr const char* const Serialization::MemberDescriptor<SerializeableT, Memb
     return name;
 }
 
+template <class SerializeableT, class MemberT>
+constexpr std::uint32_t Serialization::MemberDescriptor<SerializeableT, MemberT>::getId() const
+{
+    return id;
+}
+
+template <class SerializeableT, class MemberT>
+constexpr MemberT SerializeableT::* Serialization::MemberDescriptor<SerializeableT, MemberT>::getMember() const
+{
+    return member;
+}
+
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
@@ -22,7 +22,10 @@ class MemberDescriptor;
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include "TypeTraits.h"
+#include <cstdint>
 #include <tuple>
+#include <type_traits>
 
 namespace Serialization
 {
@@ -32,6 +35,11 @@ namespace Serialization
 
 /**
  * @brief describes a member of a class for serialization
+ * 
+ * @details MemberT keeps the const qualification of the member.
+ * Const members can only be read, ValueType is the type without it.
+ * The id is optional and only used by formats that identify members by
+ * number instead of position, see TaggedSerializer.
  */
 template <class SerializeableT, class MemberT>
 class MemberDescriptor
@@ -40,20 +48,32 @@ class MemberDescriptor
     MemberDescriptor() = delete;
 
 public:
+    using ValueType = std::remove_cv_t<MemberT>;
+    static constexpr bool isWriteable = !std::is_const_v<MemberT>;
+    /** id of members described without one */
+    static constexpr std::uint32_t noId = 0;
+
     constexpr MemberDescriptor(const MemberDescriptor& other) = default;
     constexpr MemberDescriptor& operator=(const MemberDescriptor& other) = default;
-    constexpr MemberDescriptor(const MemberT SerializeableT::*member, const char* const name);    
+    constexpr MemberDescriptor(MemberT SerializeableT::*member, const char* const name, const std::uint32_t id = noId);
+
+    constexpr const ValueType& getMemberValue(const SerializeableT& object) const;
+    constexpr void setMemberValue(SerializeableT& object, ValueType value) const;
 
-    constexpr MemberT getMemberValue(const SerializeableT& object) const;
-    constexpr void setMemberValue(SerializeableT& object, MemberT value) const;
+    template <class ReadValueT>
+    constexpr bool readMemberValue(SerializeableT& object, ReadValueT&& readValue) const;
 
     constexpr const char* const getName() const;
+    constexpr std::uint32_t getId() const;
+    constexpr MemberT SerializeableT::* getMember() const;
 
 private:
     /** class member */
-    const MemberT SerializeableT::*member;
+    MemberT SerializeableT::*member;
     /** name of the field */
     const char* const name;
+    /** stable number of the field, noId if not given */
+    std::uint32_t id;
 };
 } // Serialization
 
@@ -32,12 +32,25 @@ constexpr Serialization::MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs
 
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
 
+/**
+ * @brief calls the function on an object
+ *
+ * @details The arguments are forwarded as they are given, so lvalues and
+ * temporaries both bind to the parameters without an extra copy.
+ *
+ * @tparam CallArgTs arguments convertible to the parameters
+ * @param object object to call the function on
+ * @param arguments arguments of the call
+ * @return ReturnT whatever the function returns
+ */
 template<class SerializeableT, class ReturnT, class... ArgTs>
+template <class... CallArgTs>
 constexpr ReturnT Serialization::MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>::call(
     SerializeableT& object,
-    ArgTs&&... arguments) const
+    CallArgTs&&... arguments) const
 {
-    return (object.*function)(std::forward<ArgTs>(arguments)...);
+    static_assert(sizeof...(CallArgTs) == sizeof...(ArgTs), "wrong number of arguments");
+    return (object.*function)(std::forward<CallArgTs>(arguments)...);
 }
 
 template<class SerializeableT, class ReturnT, class... ArgTs>
@@ -22,6 +22,7 @@ class MemberFunctionDescriptor;
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include <array>
 #include <iostream>
 
 namespace Serialization
@@ -49,7 +50,8 @@ public:
         const char* const name,
         const std::array<const char* const, sizeof...(ArgTs)>&& argumentNames);
     
-    constexpr ReturnT call(SerializeableT& object, ArgTs&&... arguments) const;
+    template <class... CallArgTs>
+    constexpr ReturnT call(SerializeableT& object, CallArgTs&&... arguments) const;
     constexpr const char* const getName() const;
 
     constexpr const char* const getArgumentName(const int index) const;
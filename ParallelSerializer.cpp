@@ -0,0 +1,207 @@
+/**
+ * @file ParallelSerializer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief serializes large ranges on multiple threads
+ * @version 1.0
+ * @date 2020-08-07
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "ParallelSerializer.h"
+#include <algorithm>
+#include <iterator>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a new Parallel Serializer
+ *
+ * @param threadCount number of threads, including the calling thread
+ * @param chunkSize maximum number of elements serialized by one thread at once
+ */
+template <class SerializerT>
+Serialization::ParallelSerializer<SerializerT>::ParallelSerializer(
+    const std::size_t threadCount,
+    const std::size_t chunkSize) :
+    threadCount(std::max<std::size_t>(threadCount, 1)),
+    chunkSize(std::max<std::size_t>(chunkSize, 1)),
+    buffers(),
+    errors(this->threadCount),
+    workers()
+{
+    buffers.reserve(this->threadCount);
+    for (std::size_t ii = 0; ii < this->threadCount; ++ii) {
+        buffers.push_back(std::make_unique<BufferWriter>());
+    }
+    workers.reserve(this->threadCount - 1);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Serializes a range of objects as an array.
+ *
+ * @tparam IteratorT random access iterator to serializeable objects
+ * @param writer writer to write to
+ * @param first first element
+ * @param last end of the range
+ */
+template <class SerializerT>
+template <class IteratorT>
+void Serialization::ParallelSerializer<SerializerT>::serializeRange(
+    Writer& writer,
+    const IteratorT first,
+    const IteratorT last)
+{
+    const std::size_t count = std::distance(first, last);
+    std::size_t done = 0;
+    do {
+        const std::size_t roundCount = std::min(count - done, threadCount * chunkSize);
+        const std::size_t chunks = std::clamp<std::size_t>(roundCount, 1, threadCount);
+        auto chunkBegin = [&](const std::size_t chunk) {
+            return first + (done + (roundCount * chunk) / chunks);
+        };
+
+        try {
+            for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                workers.emplace_back(
+                    &ParallelSerializer::serializeChunk<IteratorT>,
+                    std::ref(*buffers[chunk]),
+                    std::ref(errors[chunk]),
+                    chunkBegin(chunk),
+                    chunkBegin(chunk + 1),
+                    false,
+                    (done + roundCount == count) && (chunk + 1 == chunks));
+            }
+        } catch (...) {
+            // a thread could not be started, the running ones still own their chunks
+            joinWorkers();
+            throw;
+        }
+        serializeChunk(
+            *buffers[0],
+            errors[0],
+            chunkBegin(0),
+            chunkBegin(1),
+            done == 0,
+            (done + roundCount == count) && (chunks == 1));
+        joinWorkers();
+
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            if (errors[chunk]) {
+                std::rethrow_exception(errors[chunk]);
+            }
+        }
+
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            writer.write(buffers[chunk]->getData(), buffers[chunk]->getSize());
+        }
+        done += roundCount;
+    } while (done < count);
+}
+
+/**
+ * @brief Serializes a range of objects as an array.
+ *
+ * @tparam RangeT random access range of serializeable objects, e.g. std::vector
+ * @param writer writer to write to
+ * @param range objects to serialize
+ */
+template <class SerializerT>
+template <class RangeT>
+void Serialization::ParallelSerializer<SerializerT>::serializeRange(Writer& writer, const RangeT& range)
+{
+    serializeRange(writer, std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Serializes a range of objects as an array to a stream.
+ *
+ * @tparam RangeT random access range of serializeable objects, e.g. std::vector
+ * @param os out stream to write to
+ * @param range objects to serialize
+ */
+template <class SerializerT>
+template <class RangeT>
+void Serialization::ParallelSerializer<SerializerT>::serializeRange(std::ostream& os, const RangeT& range)
+{
+    StreamWriter writer(os);
+    serializeRange(writer, std::begin(range), std::end(range));
+}
+
+template <class SerializerT>
+std::size_t Serialization::ParallelSerializer<SerializerT>::getThreadCount() const
+{
+    return threadCount;
+}
+
+/**
+ * @brief gets the number of hardware threads, at least 1
+ *
+ * @return std::size_t number of threads
+ */
+template <class SerializerT>
+std::size_t Serialization::ParallelSerializer<SerializerT>::getHardwareThreadCount()
+{
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief serializes one chunk into its buffer, runs on a worker thread.
+ *
+ * @details Exceptions are caught and kept in error, an exception leaving
+ * the thread would terminate the process.
+ *
+ * @tparam IteratorT random access iterator to serializeable objects
+ * @param buffer buffer of the chunk, cleared first
+ * @param error set to the exception of the chunk, reset on success
+ * @param first first element of the chunk
+ * @param last end of the chunk
+ * @param isFirstPart the chunk starts the array
+ * @param isLastPart the chunk ends the array
+ */
+template <class SerializerT>
+template <class IteratorT>
+void Serialization::ParallelSerializer<SerializerT>::serializeChunk(
+    BufferWriter& buffer,
+    std::exception_ptr& error,
+    const IteratorT first,
+    const IteratorT last,
+    const bool isFirstPart,
+    const bool isLastPart)
+{
+    error = nullptr;
+    try {
+        SerializerT serializer;
+        buffer.clear();
+        serializer.serializeRangePart(buffer, first, last, isFirstPart, isLastPart);
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
+/**
+ * @brief waits for all worker threads of the current round
+ */
+template <class SerializerT>
+void Serialization::ParallelSerializer<SerializerT>::joinWorkers()
+{
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,110 @@
+/**
+ * @file ParallelSerializer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief serializes large ranges on multiple threads
+ * @version 1.0
+ * @date 2020-08-07
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __PARALLELSERIALIZER_H__
+#define __PARALLELSERIALIZER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializerT>
+class ParallelSerializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BufferWriter.h"
+#include "StreamWriter.h"
+#include "Writer.h"
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief serializes large ranges on multiple threads
+ *
+ * @details The range is processed in rounds of threadCount chunks.
+ * Each chunk is serialized by its own SerializerT on its own thread into
+ * its own buffer with serializeRangePart(...), then the buffers are
+ * written in order. The output equals SerializerT::serializeRange(...).
+ * Buffers are kept between calls, so the memory of a round is only
+ * allocated once. Use one instance per calling thread.
+ * An exception of any chunk is rethrown on the calling thread once all
+ * threads of the round are joined.
+ *
+ * @tparam SerializerT default constructible serializer with serializeRangePart(...),
+ * e.g. JSONSerializer or StaticJSONSerializer
+ */
+template <class SerializerT>
+class ParallelSerializer
+{
+    // delete default constructors
+    ParallelSerializer(const ParallelSerializer& other) = delete;
+    ParallelSerializer& operator=(const ParallelSerializer& other) = delete;
+public:
+    /** elements per chunk, large enough to hide the cost of starting a thread */
+    static constexpr std::size_t defaultChunkSize = 1 << 16;
+
+    explicit ParallelSerializer(
+        const std::size_t threadCount = getHardwareThreadCount(),
+        const std::size_t chunkSize = defaultChunkSize);
+
+    template <class IteratorT>
+    void serializeRange(Writer& writer, const IteratorT first, const IteratorT last);
+
+    template <class RangeT>
+    void serializeRange(Writer& writer, const RangeT& range);
+
+    template <class RangeT>
+    void serializeRange(std::ostream& os, const RangeT& range);
+
+    std::size_t getThreadCount() const;
+
+    static std::size_t getHardwareThreadCount();
+
+private:
+    template <class IteratorT>
+    static void serializeChunk(
+        BufferWriter& buffer,
+        std::exception_ptr& error,
+        const IteratorT first,
+        const IteratorT last,
+        const bool isFirstPart,
+        const bool isLastPart);
+
+    void joinWorkers();
+
+    /** number of chunks serialized at the same time */
+    const std::size_t threadCount;
+    /** maximum number of elements per chunk */
+    const std::size_t chunkSize;
+    /** output of each chunk of a round */
+    std::vector<std::unique_ptr<BufferWriter>> buffers;
+    /** exception of each chunk of a round, empty if the chunk succeeded */
+    std::vector<std::exception_ptr> errors;
+    /** threads of the current round, the calling thread takes the first chunk */
+    std::vector<std::thread> workers;
+};
+} // Serialization
+
+// template class, include src
+#include "ParallelSerializer.cpp"
+#endif //__PARALLELSERIALIZER_H__
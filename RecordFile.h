@@ -0,0 +1,84 @@
+/**
+ * @file RecordFile.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief layout of files of binary records
+ * @version 1.0
+ * @date 2020-08-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __RECORDFILE_H__
+#define __RECORDFILE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class RecordFile;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryEncoding.h"
+#include "BufferWriter.h"
+#include "SerializerBinary.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief layout of files of binary records
+ *
+ * @details Shared by RecordFileWriter and RecordFileReader, all integers
+ * little endian like BinaryEncoding:
+ *
+ *     header   "SREC", uint32 version, uint32 schema length,
+ *              schema written by BinarySerializer::serializeStructure(...)
+ *     records  uint32 length, object written by BinarySerializer, repeated
+ *     index    uint64 file offset of each record
+ *     trailer  uint64 record count, uint64 file offset of the index, "SIDX"
+ *
+ * The trailer has a fixed size at the end of the file, so a reader
+ * finds every record without looking at the others.
+ */
+class RecordFile
+{
+    // delete default constructors
+    RecordFile() = delete;
+    RecordFile(const RecordFile& other) = delete;
+    RecordFile& operator=(const RecordFile& other) = delete;
+public:
+    using VersionType = std::uint32_t;
+    using OffsetType = std::uint64_t;
+
+    static constexpr char headerMagic[4] = {'S', 'R', 'E', 'C'};
+    static constexpr char trailerMagic[4] = {'S', 'I', 'D', 'X'};
+    static constexpr VersionType version = 1;
+
+    /** header without the schema */
+    static constexpr std::size_t headerSize =
+        sizeof(headerMagic) + sizeof(VersionType) + sizeof(BinaryEncoding::LengthType);
+    static constexpr std::size_t trailerSize = 2 * sizeof(OffsetType) + sizeof(trailerMagic);
+
+    /**
+     * @brief schema of a class as stored in the header
+     *
+     * @tparam SerializeableT any class with static descriptor
+     * @param schema writer to write the schema to
+     */
+    template <class SerializeableT>
+    static void makeSchema(BufferWriter& schema)
+    {
+        BinarySerializer serializer;
+        serializer.serializeStructure<SerializeableT>(schema);
+    }
+};
+} // Serialization
+#endif //__RECORDFILE_H__
@@ -0,0 +1,302 @@
+/**
+ * @file RecordFileReader.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief random access to memory mapped files of binary records
+ * @version 1.0
+ * @date 2020-08-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "RecordFileReader.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class SerializeableT>
+Serialization::RecordFileReader<SerializeableT>::RecordFileReader() :
+    deserializer(), data(nullptr), size(0), count(0), indexOffset(0)
+{
+}
+
+template <class SerializeableT>
+Serialization::RecordFileReader<SerializeableT>::~RecordFileReader()
+{
+    close();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Maps a file and checks its layout.
+ *
+ * @details Only header, schema and trailer are looked at, records are
+ * checked when they are read.
+ *
+ * @param path file written by RecordFileWriter<SerializeableT>
+ * @return true if the file is a complete record file of SerializeableT
+ */
+template <class SerializeableT>
+bool Serialization::RecordFileReader<SerializeableT>::open(const char* const path)
+{
+    close();
+    const int file = ::open(path, O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat status;
+    if ((fstat(file, &status) != 0) ||
+        (static_cast<std::size_t>(status.st_size) < RecordFile::headerSize + RecordFile::trailerSize)) {
+        ::close(file);
+        return false;
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    void* const mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    // the mapping keeps the file alive
+    ::close(file);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<const char*>(mapping);
+
+    // header
+    const char* position = data;
+    const auto version = BinaryEncoding::read<RecordFile::VersionType>(position + sizeof(RecordFile::headerMagic));
+    const std::size_t schemaLength = BinaryEncoding::read<BinaryEncoding::LengthType>(
+        position + sizeof(RecordFile::headerMagic) + sizeof(RecordFile::VersionType));
+    BufferWriter schema;
+    RecordFile::makeSchema<SerializeableT>(schema);
+    bool isValid = (std::memcmp(position, RecordFile::headerMagic, sizeof(RecordFile::headerMagic)) == 0) &&
+        (version == RecordFile::version) &&
+        (schemaLength == schema.getSize()) &&
+        (RecordFile::headerSize + schemaLength <= size - RecordFile::trailerSize) &&
+        (std::memcmp(position + RecordFile::headerSize, schema.getData(), schemaLength) == 0);
+
+    // trailer
+    position = data + size - RecordFile::trailerSize;
+    const auto trailerCount = BinaryEncoding::read<RecordFile::OffsetType>(position);
+    const auto trailerIndexOffset = BinaryEncoding::read<RecordFile::OffsetType>(position + sizeof(RecordFile::OffsetType));
+    isValid = isValid &&
+        (std::memcmp(position + 2 * sizeof(RecordFile::OffsetType), RecordFile::trailerMagic, sizeof(RecordFile::trailerMagic)) == 0) &&
+        (trailerIndexOffset >= RecordFile::headerSize + schemaLength) &&
+        (trailerIndexOffset <= size - RecordFile::trailerSize) &&
+        (trailerCount == (size - RecordFile::trailerSize - trailerIndexOffset) / sizeof(RecordFile::OffsetType)) &&
+        (trailerIndexOffset + trailerCount * sizeof(RecordFile::OffsetType) == size - RecordFile::trailerSize);
+    if (!isValid) {
+        close();
+        return false;
+    }
+    count = static_cast<std::size_t>(trailerCount);
+    indexOffset = static_cast<std::size_t>(trailerIndexOffset);
+
+    advise(0, size, MADV_RANDOM);
+    return true;
+}
+
+/**
+ * @brief unmaps the file, records viewed with getRecord(...) become invalid
+ */
+template <class SerializeableT>
+void Serialization::RecordFileReader<SerializeableT>::close()
+{
+    if (data != nullptr) {
+        munmap(const_cast<char*>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+    count = 0;
+    indexOffset = 0;
+}
+
+/**
+ * @brief number of records in the file
+ *
+ * @return std::size_t number of records, 0 if not open
+ */
+template <class SerializeableT>
+std::size_t Serialization::RecordFileReader<SerializeableT>::getCount() const
+{
+    return count;
+}
+
+/**
+ * @brief schema of the file, as written by BinarySerializer::serializeStructure(...)
+ *
+ * @return std::string_view schema in the mapped file
+ */
+template <class SerializeableT>
+std::string_view Serialization::RecordFileReader<SerializeableT>::getSchema() const
+{
+    if (data == nullptr) {
+        return std::string_view();
+    }
+    return std::string_view(data + RecordFile::headerSize,
+        BinaryEncoding::read<BinaryEncoding::LengthType>(data + RecordFile::headerSize - sizeof(BinaryEncoding::LengthType)));
+}
+
+/**
+ * @brief encoded bytes of a record, without its length
+ *
+ * @param index position of the record
+ * @return std::string_view record in the mapped file, without data if
+ * the index or the offset of the record is invalid
+ */
+template <class SerializeableT>
+std::string_view Serialization::RecordFileReader<SerializeableT>::getRecord(const std::size_t index) const
+{
+    if (index >= count) {
+        return std::string_view();
+    }
+    const RecordFile::OffsetType offset = getOffset(index);
+    if ((offset < RecordFile::headerSize) || (offset > indexOffset - sizeof(BinaryEncoding::LengthType))) {
+        return std::string_view();
+    }
+    const char* const record = data + offset + sizeof(BinaryEncoding::LengthType);
+    const std::size_t length = BinaryEncoding::read<BinaryEncoding::LengthType>(data + offset);
+    if (length > static_cast<std::size_t>(data + indexOffset - record)) {
+        return std::string_view();
+    }
+    return std::string_view(record, length);
+}
+
+/**
+ * @brief Decodes a single record.
+ *
+ * @param index position of the record
+ * @param object object to fill
+ * @return DeserializationResult error and file offset
+ */
+template <class SerializeableT>
+Serialization::DeserializationResult Serialization::RecordFileReader<SerializeableT>::read(
+    const std::size_t index,
+    SerializeableT& object)
+{
+    const std::string_view record = getRecord(index);
+    if (record.data() == nullptr) {
+        return DeserializationResult(DeserializationError::UnexpectedEnd, (index < count) ? getOffset(index) : size);
+    }
+    const DeserializationResult result = deserializer.deserialize(record.data(), record.size(), object);
+    return DeserializationResult(result.getError(), (record.data() - data) + result.getPosition());
+}
+
+/**
+ * @brief Decodes the records [first, last) in order, with read ahead.
+ *
+ * @tparam CallbackT callable with SerializeableT&
+ * @param first position of the first record
+ * @param last position behind the last record, limited to getCount()
+ * @param onObject called with every record, default constructed before reading
+ * @return DeserializationResult first error and file offset
+ */
+template <class SerializeableT>
+template <class CallbackT>
+Serialization::DeserializationResult Serialization::RecordFileReader<SerializeableT>::forEach(
+    const std::size_t first,
+    const std::size_t last,
+    CallbackT&& onObject)
+{
+    const std::size_t end = std::min(last, count);
+    if (first >= end) {
+        return DeserializationResult(DeserializationError::None, 0);
+    }
+    const std::size_t rangeEnd = (end == count) ? indexOffset : getOffset(end);
+    advise(getOffset(first), rangeEnd, MADV_SEQUENTIAL);
+
+    DeserializationResult result(DeserializationError::None, 0);
+    for (std::size_t index = first; (index < end) && result; ++index) {
+        SerializeableT object{};
+        result = read(index, object);
+        if (result) {
+            onObject(object);
+        }
+    }
+
+    advise(getOffset(first), rangeEnd, MADV_RANDOM);
+    return result;
+}
+
+/**
+ * @brief Finds the first record whose key is not less than key.
+ *
+ * @details Records have to be sorted by their key, e.g. a timestamp of
+ * objects appended in the order they happened. Decodes O(log n) records.
+ *
+ * @tparam KeyT type of the key
+ * @tparam KeyFunctionT callable returning the key of a const SerializeableT&
+ * @param key key to search for
+ * @param getKey returns the key of a record
+ * @return std::size_t position of the record, getCount() if there is none
+ * or a record can not be read
+ */
+template <class SerializeableT>
+template <class KeyT, class KeyFunctionT>
+std::size_t Serialization::RecordFileReader<SerializeableT>::lowerBound(const KeyT& key, KeyFunctionT&& getKey)
+{
+    std::size_t low = 0;
+    std::size_t high = count;
+    while (low < high) {
+        const std::size_t middle = low + (high - low) / 2;
+        SerializeableT object{};
+        if (!read(middle, object)) {
+            return count;
+        }
+        if (getKey(static_cast<const SerializeableT&>(object)) < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief file offset of a record from the index
+ *
+ * @param index position of the record, below count
+ * @return RecordFile::OffsetType offset of its length
+ */
+template <class SerializeableT>
+Serialization::RecordFile::OffsetType Serialization::RecordFileReader<SerializeableT>::getOffset(
+    const std::size_t index) const
+{
+    return BinaryEncoding::read<RecordFile::OffsetType>(data + indexOffset + index * sizeof(RecordFile::OffsetType));
+}
+
+/**
+ * @brief tells the kernel how a part of the file will be accessed.
+ *
+ * @param begin first byte, rounded down to its page
+ * @param end end of the part
+ * @param advice MADV_RANDOM or MADV_SEQUENTIAL
+ */
+template <class SerializeableT>
+void Serialization::RecordFileReader<SerializeableT>::advise(
+    const std::size_t begin,
+    const std::size_t end,
+    const int advice) const
+{
+    static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const std::size_t pageBegin = begin - (begin % pageSize);
+    if (end > pageBegin) {
+        // only a hint, failing changes nothing but speed
+        madvise(const_cast<char*>(data) + pageBegin, end - pageBegin, advice);
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
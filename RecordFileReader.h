@@ -0,0 +1,93 @@
+/**
+ * @file RecordFileReader.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief random access to memory mapped files of binary records
+ * @version 1.0
+ * @date 2020-08-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __RECORDFILEREADER_H__
+#define __RECORDFILEREADER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializeableT>
+class RecordFileReader;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "DeserializationResult.h"
+#include "DeserializerBinary.h"
+#include "RecordFile.h"
+#include <cstddef>
+#include <string_view>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief random access to memory mapped files of binary records
+ *
+ * @details Maps a file written by RecordFileWriter instead of reading it.
+ * Opening only checks header, schema and trailer, so it takes the same
+ * time for any number of records, and fetching a record decodes only that
+ * record. The kernel is told to expect random access, forEach(...) asks
+ * it to read ahead for the iterated records. The schema has to equal the
+ * one of SerializeableT, otherwise open(...) fails.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ */
+template <class SerializeableT>
+class RecordFileReader
+{
+    // delete default constructors
+    RecordFileReader(const RecordFileReader& other) = delete;
+    RecordFileReader& operator=(const RecordFileReader& other) = delete;
+public:
+    RecordFileReader();
+    ~RecordFileReader();
+
+    bool open(const char* const path);
+    void close();
+
+    std::size_t getCount() const;
+    std::string_view getSchema() const;
+    std::string_view getRecord(const std::size_t index) const;
+
+    DeserializationResult read(const std::size_t index, SerializeableT& object);
+
+    template <class CallbackT>
+    DeserializationResult forEach(const std::size_t first, const std::size_t last, CallbackT&& onObject);
+
+    template <class KeyT, class KeyFunctionT>
+    std::size_t lowerBound(const KeyT& key, KeyFunctionT&& getKey);
+
+private:
+    RecordFile::OffsetType getOffset(const std::size_t index) const;
+    void advise(const std::size_t begin, const std::size_t end, const int advice) const;
+
+    /** reads the records */
+    BinaryDeserializer deserializer;
+    /** mapped file, nullptr if not open */
+    const char* data;
+    /** size of the file */
+    std::size_t size;
+    /** number of records */
+    std::size_t count;
+    /** file offset of the index */
+    std::size_t indexOffset;
+};
+} // Serialization
+
+// template class, include src
+#include "RecordFileReader.cpp"
+#endif //__RECORDFILEREADER_H__
@@ -0,0 +1,128 @@
+/**
+ * @file RecordFileWriter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief appends binary records to a file with an offset index
+ * @version 1.0
+ * @date 2020-08-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "RecordFileWriter.h"
+#include <limits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class SerializeableT>
+Serialization::RecordFileWriter<SerializeableT>::RecordFileWriter() :
+    file(), writer(), serializer(), offsets(), size(0)
+{
+}
+
+/**
+ * @brief writes the index if the file is still open
+ */
+template <class SerializeableT>
+Serialization::RecordFileWriter<SerializeableT>::~RecordFileWriter()
+{
+    close();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Creates the file and writes the header.
+ *
+ * @param path file to create, an existing one is replaced
+ * @return true on success
+ */
+template <class SerializeableT>
+bool Serialization::RecordFileWriter<SerializeableT>::open(const char* const path)
+{
+    close();
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    writer = std::make_unique<StreamWriter>(file);
+    offsets.clear();
+
+    BufferWriter schema;
+    RecordFile::makeSchema<SerializeableT>(schema);
+    writer->write(RecordFile::headerMagic, sizeof(RecordFile::headerMagic));
+    BinaryEncoding::write(*writer, RecordFile::version);
+    BinaryEncoding::writeLength(*writer, schema.getSize());
+    writer->write(schema.getData(), schema.getSize());
+    size = RecordFile::headerSize + schema.getSize();
+    return true;
+}
+
+/**
+ * @brief Appends an object as the next record.
+ *
+ * @param object object to write
+ * @return true if the file is open and the record fits its length prefix
+ */
+template <class SerializeableT>
+bool Serialization::RecordFileWriter<SerializeableT>::append(const SerializeableT& object)
+{
+    if (!writer) {
+        return false;
+    }
+    const std::size_t length = BinarySerializer::serializedSize(object);
+    if (length > std::numeric_limits<BinaryEncoding::LengthType>::max()) {
+        return false;
+    }
+    offsets.push_back(size);
+    BinaryEncoding::writeLength(*writer, length);
+    serializer.serialize(*writer, object);
+    size += sizeof(BinaryEncoding::LengthType) + length;
+    return true;
+}
+
+/**
+ * @brief Writes index and trailer and closes the file.
+ *
+ * @return true if everything was written, false if the file was not open
+ */
+template <class SerializeableT>
+bool Serialization::RecordFileWriter<SerializeableT>::close()
+{
+    if (!writer) {
+        return false;
+    }
+    for (const RecordFile::OffsetType offset : offsets) {
+        BinaryEncoding::write(*writer, offset);
+    }
+    BinaryEncoding::write(*writer, static_cast<RecordFile::OffsetType>(offsets.size()));
+    BinaryEncoding::write(*writer, size);
+    writer->write(RecordFile::trailerMagic, sizeof(RecordFile::trailerMagic));
+    writer.reset();
+
+    file.close();
+    return !file.fail();
+}
+
+/**
+ * @brief number of records appended since open(...)
+ *
+ * @return std::size_t number of records
+ */
+template <class SerializeableT>
+std::size_t Serialization::RecordFileWriter<SerializeableT>::getCount() const
+{
+    return offsets.size();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
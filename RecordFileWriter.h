@@ -0,0 +1,81 @@
+/**
+ * @file RecordFileWriter.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief appends binary records to a file with an offset index
+ * @version 1.0
+ * @date 2020-08-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __RECORDFILEWRITER_H__
+#define __RECORDFILEWRITER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class SerializeableT>
+class RecordFileWriter;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "RecordFile.h"
+#include "SerializerBinary.h"
+#include "StreamWriter.h"
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief appends binary records to a file with an offset index
+ *
+ * @details Writes the layout of RecordFile. Records are written through
+ * a StreamWriter as they are appended, with their length known up front
+ * from BinarySerializer::serializedSize(...). Only the offsets are kept
+ * in memory until close() writes them as index.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ */
+template <class SerializeableT>
+class RecordFileWriter
+{
+    // delete default constructors
+    RecordFileWriter(const RecordFileWriter& other) = delete;
+    RecordFileWriter& operator=(const RecordFileWriter& other) = delete;
+public:
+    RecordFileWriter();
+    ~RecordFileWriter();
+
+    bool open(const char* const path);
+    bool append(const SerializeableT& object);
+    bool close();
+
+    std::size_t getCount() const;
+
+private:
+    /** file being written */
+    std::ofstream file;
+    /** collects the output for file, exists while the file is open */
+    std::unique_ptr<StreamWriter> writer;
+    /** writes the records */
+    BinarySerializer serializer;
+    /** file offset of each record */
+    std::vector<RecordFile::OffsetType> offsets;
+    /** bytes written so far */
+    RecordFile::OffsetType size;
+};
+} // Serialization
+
+// template class, include src
+#include "RecordFileWriter.cpp"
+#endif //__RECORDFILEWRITER_H__
@@ -13,7 +13,6 @@
 
 #include "Serializer.h"
 
-#include <tuple>
 #include <type_traits>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
@@ -37,47 +36,179 @@ Serialization::Serializer::Serializer()
  * Every member described in that tuple will be serialized.
  * 
  * @tparam SerializeableT any class with static descriptors tuple.
- * @param os out stream to write to
+ * @param writer writer to write to
  * @param object object to serialize
  */
 template <class SerializeableT,
-        typename std::enable_if_t<
-            !(std::is_same_v<char, SerializeableT> ||
-            std::is_same_v<int, SerializeableT> ||
-            std::is_same_v<const char*, SerializeableT> ||
-            std::is_same_v<bool, SerializeableT>), int>  = 0>
-void Serialization::Serializer::serialize(std::ostream& os, const SerializeableT& object)
+        typename std::enable_if_t<Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+void Serialization::Serializer::serialize(Writer& writer, const SerializeableT& object)
 {
-    serializeObjectStart(os);
-    std::apply([&os, &object, this](const auto& ...descriptor){
-        bool firstMember = true;
-        (this->serializeMember(os, descriptor, object, firstMember), ...);
-    }, SerializeableT::descriptor.memberDescriptors);
-    serializeObjectEnd(os);
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, writer.getPosition());
+    serializeObjectStart(writer);
+    serializeMembers(writer, object);
+    serializeObjectEnd(writer);
+    scope.finish(writer.getPosition());
 }
 
 /**
- * @brief Serializes any primitive types.
+ * @brief Serializes primitive types, strings, sequences and optionals.
  * 
- * @details primitive types are defined by the is_primitive function.
+ * @details primitive types are defined by TypeTraits::isPrimitive.
  * The serialization of these needs to be hardcoded in any
  * Serializer by overriding the serializeValue(...) functions.
  * 
- * @tparam SerializeableT SerializeableT any class with static descriptors tuple.
+ * @tparam SerializeableT any type but described classes
+ * @param writer writer to write to
+ * @param value value to serialize
+ */
+template <class SerializeableT,
+    typename std::enable_if_t<!Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+void Serialization::Serializer::serialize(Writer& writer, const SerializeableT& value)
+{
+    if constexpr (TypeTraits::isString<SerializeableT>) {
+        serializeValue(writer, value.data(), value.size());
+    } else if constexpr (TypeTraits::isSequence<SerializeableT>) {
+        serializeSequence(writer, value);
+    } else if constexpr (TypeTraits::isOptional<SerializeableT>) {
+        serializeOptional(writer, value);
+    } else {
+        serializeValue(writer, static_cast<TypeTraits::FixedWidthType<SerializeableT>>(value));
+    }
+}
+
+/**
+ * @brief Serializes an object to a stream.
+ * 
+ * @details Adapter for the std::ostream interface, the output is
+ * collected by a StreamWriter and handed to the stream in blocks.
+ * 
+ * @tparam SerializeableT any serializeable type
  * @param os out stream to write to
  * @param object object to serialize
  */
-template <class SerializeableT,
-    typename std::enable_if_t<
-    (
-        std::is_same_v<char, SerializeableT> ||
-        std::is_same_v<int, SerializeableT> ||
-        std::is_same_v<const char*, SerializeableT> ||
-        std::is_same_v<bool, SerializeableT>
-    ), int>  = 0>
-void Serialization::Serializer::serialize(std::ostream& os, const SerializeableT& value)
+template <class SerializeableT>
+void Serialization::Serializer::serialize(std::ostream& os, const SerializeableT& object)
+{
+    StreamWriter writer(os);
+    serialize(writer, object);
+}
+
+/**
+ * @brief Serializes a range of objects as an array.
+ * 
+ * @details The seperator and object start in front of each element only
+ * depend on the format. They are collected once per range and written
+ * with a single copy, so the loop only costs the members of each element.
+ * Every element is instrumented as one call of serialize(...).
+ * 
+ * @tparam IteratorT input iterator to serializeable objects
+ * @param writer writer to write to
+ * @param first first element
+ * @param last end of the range
+ */
+template <class IteratorT>
+void Serialization::Serializer::serializeRange(Writer& writer, IteratorT first, const IteratorT last)
 {
-    serializeValue(os, value);
+    serializeRangePart(writer, first, last, true, true);
+}
+
+/**
+ * @brief Serializes a range of objects as an array.
+ * 
+ * @tparam RangeT any range of serializeable objects, e.g. std::vector
+ * @param writer writer to write to
+ * @param range objects to serialize
+ */
+template <class RangeT>
+void Serialization::Serializer::serializeRange(Writer& writer, const RangeT& range)
+{
+    serializeRange(writer, std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Serializes a range of objects as an array to a stream.
+ * 
+ * @tparam RangeT any range of serializeable objects, e.g. std::vector
+ * @param os out stream to write to
+ * @param range objects to serialize
+ */
+template <class RangeT>
+void Serialization::Serializer::serializeRange(std::ostream& os, const RangeT& range)
+{
+    StreamWriter writer(os);
+    serializeRange(writer, std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Serializes a consecutive part of an array.
+ * 
+ * @details Used to split a range into chunks that are serialized
+ * independently, e.g. on different threads. Concatenating the parts in
+ * order gives the same output as serializeRange(...) for the whole range.
+ * 
+ * @tparam IteratorT input iterator to serializeable objects
+ * @param writer writer to write to
+ * @param first first element of the part
+ * @param last end of the part
+ * @param isFirstPart the part starts the array, no seperator in front
+ * @param isLastPart the part ends the array
+ */
+template <class IteratorT>
+void Serialization::Serializer::serializeRangePart(
+    Writer& writer,
+    IteratorT first,
+    const IteratorT last,
+    const bool isFirstPart,
+    const bool isLastPart)
+{
+    using SerializeableT = std::remove_cv_t<std::remove_reference_t<decltype(*first)>>;
+    constexpr bool isObject = TypeTraits::isDescribed<SerializeableT>;
+
+    if (isFirstPart) {
+        serializeArrayStart(writer);
+    }
+
+    char prefix[maxElementPrefixLength];
+    SpanWriter prefixWriter(prefix, sizeof(prefix));
+    serializeSeperator(prefixWriter);
+    const std::size_t seperatorLength = prefixWriter.getSize();
+    if constexpr (isObject) {
+        serializeObjectStart(prefixWriter);
+    }
+    const bool isPrefixCollected = !prefixWriter.hasOverflowed();
+    const std::size_t prefixLength = prefixWriter.getSize();
+
+    // the first element of the array only gets the object start of the prefix
+    for (bool isFirstElement = isFirstPart; first != last; ++first, isFirstElement = false) {
+        // start of the element after its seperator, as serialize(...) would count it
+        std::size_t elementStart = writer.getPosition();
+        if (!isPrefixCollected) {
+            if (!isFirstElement) {
+                serializeSeperator(writer);
+                elementStart = writer.getPosition();
+            }
+            if constexpr (isObject) {
+                serializeObjectStart(writer);
+            }
+        } else if (isFirstElement) {
+            writer.write(prefix + seperatorLength, prefixLength - seperatorLength);
+        } else {
+            elementStart += seperatorLength;
+            writer.write(prefix, prefixLength);
+        }
+
+        if constexpr (isObject) {
+            Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, elementStart);
+            serializeMembers(writer, *first);
+            serializeObjectEnd(writer);
+            scope.finish(writer.getPosition());
+        } else {
+            serialize(writer, *first);
+        }
+    }
+    if (isLastPart) {
+        serializeArrayEnd(writer);
+    }
 }
 
 /**
@@ -88,70 +219,151 @@ void Serialization::Serializer::serialize(std::ostream& os, const SerializeableT
  * serializeType...(...) functions.
  * 
  * @tparam SerializeableT type to write descriptor of
- * @param os stream to write the descriptor to
+ * @param writer writer to write to
  */
 template <class SerializeableT>
-void Serialization::Serializer::serializeStructure(std::ostream& os)
+void Serialization::Serializer::serializeStructure(Writer& writer)
 {
-    serializeObjectStart(os);
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::SerializeStructure, writer.getPosition());
+    serializeObjectStart(writer);
 
     // serialize name
-    serializeName(os, getClassNameFieldName());
-    serializeValue(os, SerializeableT::descriptor.getName());
-    serializeSeperator(os);
+    serializeName(writer, getClassNameFieldName());
+    serializeValue(writer, SerializeableT::descriptor.getName());
+    serializeSeperator(writer);
 
     // serialize members
-    serializeName(os, getMembersFieldName());
-    serializeObjectStart(os);
-    std::apply([&os, this](const auto& ...descriptor){
+    serializeName(writer, getMembersFieldName());
+    serializeObjectStart(writer);
+    SerializeableT::descriptor.memberDescriptors.apply([&writer, this](const auto& ...descriptor){
         bool firstDescriptor = true;
-        (this->serializeMemberDescriptors(os, descriptor, firstDescriptor), ...);
-    }, SerializeableT::descriptor.memberDescriptors);
-    serializeObjectEnd(os);
-    serializeSeperator(os);
+        (this->serializeMemberDescriptors(writer, descriptor, firstDescriptor), ...);
+    });
+    serializeObjectEnd(writer);
+    serializeSeperator(writer);
 
     // serialize functions
-    serializeName(os, getFunctionsFieldName());
-    serializeObjectStart(os);
-    std::apply([&os, this](const auto& ...descriptor){
+    serializeName(writer, getFunctionsFieldName());
+    serializeObjectStart(writer);
+    SerializeableT::descriptor.memberDescriptors.apply([&writer, this](const auto& ...descriptor){
         bool firstDescriptor = true;
-        (this->serializeFunctionDescriptors(os, descriptor, firstDescriptor), ...);
-    }, SerializeableT::descriptor.memberDescriptors);
-    serializeObjectEnd(os);
-    serializeObjectEnd(os);
+        (this->serializeFunctionDescriptors(writer, descriptor, firstDescriptor), ...);
+    });
+    serializeObjectEnd(writer);
+    serializeObjectEnd(writer);
+    scope.finish(writer.getPosition());
+}
+
+/**
+ * @brief Serializes the structure of an object to a stream.
+ * 
+ * @tparam SerializeableT type to write descriptor of
+ * @param os stream to write the descriptor to
+ */
+template <class SerializeableT>
+void Serialization::Serializer::serializeStructure(std::ostream& os)
+{
+    StreamWriter writer(os);
+    serializeStructure<SerializeableT>(writer);
 }
 
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
+/**
+ * @brief serializes all members of an object, without object start and end.
+ * 
+ * @tparam SerializeableT any class with static descriptors tuple.
+ * @param writer writer to write to
+ * @param object object to serialize
+ */
+template <class SerializeableT>
+void Serialization::Serializer::serializeMembers(Writer& writer, const SerializeableT& object)
+{
+    SerializeableT::descriptor.memberDescriptors.apply([&writer, &object, this](const auto& ...descriptor){
+        bool firstMember = true;
+        (this->serializeMember(writer, descriptor, object, firstMember), ...);
+    });
+}
+
+/**
+ * @brief serializes a std::vector or std::array as an array.
+ * 
+ * @details Contiguous sequences of primitives are handed to a single
+ * serializeValues(...) call, so the format can reserve the output once
+ * and loop without a virtual call per element.
+ * 
+ * @tparam SequenceT std::vector or std::array
+ * @param writer writer to write to
+ * @param sequence elements to serialize
+ */
+template <class SequenceT>
+void Serialization::Serializer::serializeSequence(Writer& writer, const SequenceT& sequence)
+{
+    if constexpr (!TypeTraits::isFixedSequence<SequenceT>) {
+        serializeArrayLength(writer, sequence.size());
+    }
+    serializeArrayStart(writer);
+    if constexpr (TypeTraits::isBulkSequence<SequenceT>) {
+        serializeValues(writer, sequence.data(), sequence.size());
+    } else {
+        bool firstElement = true;
+        for (const auto& element : sequence) {
+            if (!firstElement) {
+                serializeSeperator(writer);
+            } else {
+                firstElement = false;
+            }
+            serialize(writer, static_cast<const typename SequenceT::value_type&>(element));
+        }
+    }
+    serializeArrayEnd(writer);
+}
+
+/**
+ * @brief serializes a std::optional, the format marks whether it has a value.
+ * 
+ * @tparam OptionalT std::optional
+ * @param writer writer to write to
+ * @param optional value to serialize
+ */
+template <class OptionalT>
+void Serialization::Serializer::serializeOptional(Writer& writer, const OptionalT& optional)
+{
+    serializeOptionalStart(writer, optional.has_value());
+    if (optional.has_value()) {
+        serialize(writer, *optional);
+    }
+}
+
 /**
  * @brief channels the serialization of a member to the right functions.
  * 
  * @tparam SerializeableT 
  * @tparam MemberT 
- * @param os 
+ * @param writer writer to write to
  * @param descriptor 
  * @param object 
  * @param firstMember 
  */
 template <class SerializeableT, class MemberT>
 void Serialization::Serializer::serializeMember(
-    std::ostream& os,
+    Writer& writer,
     const MemberDescriptor<SerializeableT, MemberT>& descriptor,
     const SerializeableT& object,
     bool& firstMember)
 {
     // forward to virtual function that does member seperators
     if (!firstMember) {
-        serializeSeperator(os);
+        serializeSeperator(writer);
     } else {
         firstMember = false;
     }
 
-    serializeName(os, descriptor.getName());
+    serializeName(writer, descriptor.getName());
     // forward to virtual functions for value output
-    serialize(os, descriptor.getMemberValue(object));
+    serialize(writer, descriptor.getMemberValue(object));
 }
 
 /**
@@ -162,14 +374,14 @@ void Serialization::Serializer::serializeMember(
  * @tparam SerializeableT 
  * @tparam ReturnT 
  * @tparam ArgTs 
- * @param os 
+ * @param writer writer to write to
  * @param descriptor 
  * @param object 
  * @param firstMember 
  */
 template <class SerializeableT, class ReturnT, class... ArgTs>
 void Serialization::Serializer::serializeMember(
-    std::ostream& os,
+    Writer& writer,
     const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
     const SerializeableT& object,
     bool& firstMember)
@@ -181,69 +393,131 @@ void Serialization::Serializer::serializeMember(
  * @brief recurses to serialize encapsulated serializeable types.
  * 
  * @tparam MemberT serializeable type.
- * @param os stream to serialize to
+ * @param writer writer to write to
  */
 template <class MemberT,
-    typename std::enable_if_t<
-        !std::is_same_v<char, MemberT> &&
-        !std::is_same_v<int, MemberT> &&
-        !std::is_same_v<const char*, MemberT> &&
-        !std::is_same_v<bool, MemberT>, int>  = 0>
-void Serialization::Serializer::serializeType(std::ostream& os)
+    typename std::enable_if_t<Serialization::TypeTraits::isDescribed<MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
 {
-    serializeStructure<MemberT>(os);
+    serializeStructure<MemberT>(writer);
 }
 
 /**
  * @brief forwards writing of char to overwriteable function
  * 
  * @tparam MemberT char
- * @param os out stream
+ * @param writer writer to write to
  */
 template <class MemberT,
-    typename std::enable_if_t<std::is_same_v<char, MemberT>, int> = 0>
-void Serialization::Serializer::serializeType(std::ostream& os)
+    typename std::enable_if_t<std::is_same_v<char, MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
 {
-    serializeTypeChar(os);
+    serializeTypeChar(writer);
 }
 
 /**
- * @brief forwards writing of int to overwriteable function
+ * @brief forwards writing of numbers to the overwriteable function of their width
  * 
- * @tparam MemberT int
- * @param os out stream
+ * @tparam MemberT integer or floating point type
+ * @param writer writer to write to
  */
 template <class MemberT,
-    typename std::enable_if_t<std::is_same_v<int, MemberT>, int> = 0>
-void Serialization::Serializer::serializeType(std::ostream& os)
+    typename std::enable_if_t<Serialization::TypeTraits::isInteger<MemberT> ||
+        Serialization::TypeTraits::isFloatingPoint<MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
 {
-    serializeTypeInt(os);
+    using NumberT = TypeTraits::FixedWidthType<MemberT>;
+
+    if constexpr (std::is_same_v<std::int32_t, NumberT>) {
+        serializeTypeInt(writer);
+    } else if constexpr (std::is_same_v<std::int8_t, NumberT>) {
+        serializeTypeInt8(writer);
+    } else if constexpr (std::is_same_v<std::uint8_t, NumberT>) {
+        serializeTypeUInt8(writer);
+    } else if constexpr (std::is_same_v<std::int16_t, NumberT>) {
+        serializeTypeInt16(writer);
+    } else if constexpr (std::is_same_v<std::uint16_t, NumberT>) {
+        serializeTypeUInt16(writer);
+    } else if constexpr (std::is_same_v<std::uint32_t, NumberT>) {
+        serializeTypeUInt32(writer);
+    } else if constexpr (std::is_same_v<std::int64_t, NumberT>) {
+        serializeTypeInt64(writer);
+    } else if constexpr (std::is_same_v<std::uint64_t, NumberT>) {
+        serializeTypeUInt64(writer);
+    } else if constexpr (std::is_same_v<float, NumberT>) {
+        serializeTypeFloat(writer);
+    } else if constexpr (std::is_same_v<double, NumberT>) {
+        serializeTypeDouble(writer);
+    }
 }
 
 /**
  * @brief forwards writing of string to overwriteable function
  * 
  * @tparam MemberT string
- * @param os out stream
+ * @param writer writer to write to
  */
 template <class MemberT,
-    typename std::enable_if_t<std::is_same_v<const char*, MemberT>, int> = 0>
-void Serialization::Serializer::serializeType(std::ostream& os)
+    typename std::enable_if_t<std::is_same_v<const char*, MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
 {
-    serializeTypeString(os);
+    serializeTypeString(writer);
 }
 
 /**
  * @brief forwards writing of bool to overwriteable function
  * 
  * @tparam MemberT bool
- * @param os out stream
+ * @param writer writer to write to
+ */
+template <class MemberT,
+    typename std::enable_if_t<std::is_same_v<bool, MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
+{
+    serializeTypeBool(writer);
+}
+
+/**
+ * @brief std::string has the same type as const char*
+ * 
+ * @tparam MemberT std::string
+ * @param writer writer to write to
+ */
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isString<MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
+{
+    serializeTypeString(writer);
+}
+
+/**
+ * @brief describes a sequence by its element type
+ * 
+ * @tparam MemberT std::vector or std::array
+ * @param writer writer to write to
+ */
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isSequence<MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
+{
+    serializeTypeSequenceStart(writer, TypeTraits::isFixedSequence<MemberT>, TypeTraits::fixedLength<MemberT>);
+    serializeType<typename MemberT::value_type>(writer);
+    serializeTypeSequenceEnd(writer);
+}
+
+/**
+ * @brief describes an optional by its value type
+ * 
+ * @tparam MemberT std::optional
+ * @param writer writer to write to
  */
 template <class MemberT,
-    typename std::enable_if_t<std::is_same_v<bool, MemberT>, int> = 0>
-void Serialization::Serializer::serializeType(std::ostream& os)
+    typename std::enable_if_t<Serialization::TypeTraits::isOptional<MemberT>, int>>
+void Serialization::Serializer::serializeType(Writer& writer)
 {
-    serializeTypeBool(os);
+    serializeTypeOptionalStart(writer);
+    serializeType<typename MemberT::value_type>(writer);
+    serializeTypeOptionalEnd(writer);
 }
 
 /**
@@ -251,27 +525,27 @@ void Serialization::Serializer::serializeType(std::ostream& os)
  * 
  * @tparam SerializeableT 
  * @tparam MemberT 
- * @param os 
+ * @param writer writer to write to
  * @param descriptor 
  */
 template <class SerializeableT, class MemberT>
 void Serialization::Serializer::serializeMemberDescriptors(
-    std::ostream& os,
+    Writer& writer,
     const MemberDescriptor<SerializeableT, MemberT>& descriptor,
     bool& firstDescriptor)
 {
     // forward seperator serialization
     if (!firstDescriptor) {
-        serializeSeperator(os);
+        serializeSeperator(writer);
     } else {
         firstDescriptor = false;
     }
 
     // forward member name serialization
-    serializeName(os, descriptor.getName());
+    serializeName(writer, descriptor.getName());
 
     // forward serialization of type info
-    serializeType<MemberT>(os);
+    serializeType<std::remove_cv_t<MemberT>>(writer);
 }
 
 /**
@@ -280,13 +554,13 @@ void Serialization::Serializer::serializeMemberDescriptors(
  * @tparam SerializeableT 
  * @tparam ReturnT 
  * @tparam ArgTs 
- * @param os 
+ * @param writer writer to write to
  * @param descriptor 
  * @param firstDescriptor 
  */
 template <class SerializeableT, class ReturnT, class... ArgTs>
 void Serialization::Serializer::serializeMemberDescriptors(
-    std::ostream& os,
+    Writer& writer,
     const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
     bool& firstDescriptor)
 {
@@ -298,13 +572,13 @@ void Serialization::Serializer::serializeMemberDescriptors(
  * 
  * @tparam SerializeableT 
  * @tparam MemberT 
- * @param os 
+ * @param writer writer to write to
  * @param descriptor 
  * @param firstDescriptor 
  */
 template <class SerializeableT, class MemberT>
 void Serialization::Serializer::serializeFunctionDescriptors(
-    std::ostream& os,
+    Writer& writer,
     const MemberDescriptor<SerializeableT, MemberT>& descriptor,
     bool& firstDescriptor)
 {
@@ -318,49 +592,49 @@ void Serialization::Serializer::serializeFunctionDescriptors(
  * @tparam SerializeableT 
  * @tparam ReturnT 
  * @tparam ArgTs 
- * @param os 
+ * @param writer writer to write to
  * @param descriptor 
  * @param firstDescriptor 
  */
 template <class SerializeableT, class ReturnT, class... ArgTs>
 void Serialization::Serializer::serializeFunctionDescriptors(
-    std::ostream& os,
+    Writer& writer,
     const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
     bool& firstDescriptor)
 {
     // forward seperator serialization
     if (!firstDescriptor) {
-        serializeSeperator(os);
+        serializeSeperator(writer);
     } else {
         firstDescriptor = false;
     }
 
     // forward member name serialization
-    serializeName(os, descriptor.getName());
+    serializeName(writer, descriptor.getName());
 
     // serialize arguments
-    serializeName(os, getFunctionArgumentsFieldName());
-    serializeObjectStart(os);
+    serializeName(writer, getFunctionArgumentsFieldName());
+    serializeObjectStart(writer);
 
     int ii = 0;
     bool firstElement = true;
-    (serializeFunctionArgument<ArgTs>(os, descriptor.getArgumentName(ii++), firstElement), ...);
+    (serializeFunctionArgument<ArgTs>(writer, descriptor.getArgumentName(ii++), firstElement), ...);
 
-    serializeObjectEnd(os);
+    serializeObjectEnd(writer);
 }
 
 template <class ArgT>
-void Serialization::Serializer::serializeFunctionArgument(std::ostream& os, const char* const name, bool& firstElement)
+void Serialization::Serializer::serializeFunctionArgument(Writer& writer, const char* const name, bool& firstElement)
 {
     // forward seperator serialization
     if (!firstElement) {
-        serializeSeperator(os);
+        serializeSeperator(writer);
     } else {
         firstElement = false;
     }
 
-    serializeName(os, name);
-    serializeType<ArgT>(os);
+    serializeName(writer, name);
+    serializeType<ArgT>(writer);
 }
 
 //---------------------------- STATIC FUNCTIONS -------------------------------
\ No newline at end of file
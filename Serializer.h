@@ -21,9 +21,16 @@ class Serializer;
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include "Instrumentation.h"
 #include "MemberFunctionDescriptor.h"
 #include "MemberDescriptor.h"
+#include "SpanWriter.h"
+#include "StreamWriter.h"
+#include "TypeTraits.h"
+#include "Writer.h"
 
 namespace Serialization
 {
@@ -42,46 +49,99 @@ class Serializer
     Serializer& operator=(const Serializer& other) = delete;
 public:
     template <class SerializeableT,
-        typename std::enable_if_t<
-            !(std::is_same_v<char, SerializeableT> ||
-            std::is_same_v<int, SerializeableT> ||
-            std::is_same_v<const char*, SerializeableT> ||
-            std::is_same_v<bool, SerializeableT>), int>  = 0>
-    void serialize(std::ostream& os, const SerializeableT& object);
+        typename std::enable_if_t<TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    void serialize(Writer& writer, const SerializeableT& object);
 
     template <class SerializeableT,
-        typename std::enable_if_t<
-        (
-            std::is_same_v<char, SerializeableT> ||
-            std::is_same_v<int, SerializeableT> ||
-            std::is_same_v<const char*, SerializeableT> ||
-            std::is_same_v<bool, SerializeableT>
-        ), int>  = 0>
-    void serialize(std::ostream& os, const SerializeableT& value);
+        typename std::enable_if_t<!TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    void serialize(Writer& writer, const SerializeableT& value);
+
+    template <class SerializeableT>
+    void serialize(std::ostream& os, const SerializeableT& object);
+
+    template <class IteratorT>
+    void serializeRange(Writer& writer, IteratorT first, const IteratorT last);
+
+    template <class RangeT>
+    void serializeRange(Writer& writer, const RangeT& range);
 
+    template <class RangeT>
+    void serializeRange(std::ostream& os, const RangeT& range);
 
-    template <class SerialzeableT>
+    template <class IteratorT>
+    void serializeRangePart(
+        Writer& writer,
+        IteratorT first,
+        const IteratorT last,
+        const bool isFirstPart,
+        const bool isLastPart);
+
+    template <class SerializeableT>
+    void serializeStructure(Writer& writer);
+
+    template <class SerializeableT>
     void serializeStructure(std::ostream& os);
 
 protected:
-    Serializer();
+    /** maximum length of seperator and object start, collected once per range */
+    static constexpr std::size_t maxElementPrefixLength = 16;
 
-    virtual void serializeObjectStart(std::ostream& os) = 0;
-    virtual void serializeObjectEnd(std::ostream& os) = 0;
-    virtual void serializeArrayStart(std::ostream& os) = 0;
-    virtual void serializeArrayEnd(std::ostream& os) = 0;
-    virtual void serializeName(std::ostream& os, const char* const name) = 0;
-    virtual void serializeSeperator(std::ostream& os) = 0;
-
-    virtual void serializeValue(std::ostream& os, const int& value) = 0;
-    virtual void serializeValue(std::ostream& os, const char& value) = 0;
-    virtual void serializeValue(std::ostream& os, const bool& value) = 0;
-    virtual void serializeValue(std::ostream& os, const char* const value) = 0;
+    Serializer();
 
-    virtual void serializeTypeInt(std::ostream& os) = 0;
-    virtual void serializeTypeChar(std::ostream& os) = 0;
-    virtual void serializeTypeBool(std::ostream& os) = 0;
-    virtual void serializeTypeString(std::ostream& os) = 0;
+    virtual void serializeObjectStart(Writer& writer) = 0;
+    virtual void serializeObjectEnd(Writer& writer) = 0;
+    virtual void serializeArrayStart(Writer& writer) = 0;
+    virtual void serializeArrayEnd(Writer& writer) = 0;
+    virtual void serializeName(Writer& writer, const char* const name) = 0;
+    virtual void serializeSeperator(Writer& writer) = 0;
+
+    virtual void serializeValue(Writer& writer, const int& value) = 0;
+    virtual void serializeValue(Writer& writer, const char& value) = 0;
+    virtual void serializeValue(Writer& writer, const bool& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::int8_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::uint8_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::int16_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::uint16_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::uint32_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::int64_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const std::uint64_t& value) = 0;
+    virtual void serializeValue(Writer& writer, const float& value) = 0;
+    virtual void serializeValue(Writer& writer, const double& value) = 0;
+    virtual void serializeValue(Writer& writer, const char* const value) = 0;
+    virtual void serializeValue(Writer& writer, const char* const value, const std::size_t length) = 0;
+
+    virtual void serializeValues(Writer& writer, const int* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const char* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const bool* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::int8_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::uint8_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::int16_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::uint16_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::uint32_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::int64_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const std::uint64_t* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const float* const values, const std::size_t count) = 0;
+    virtual void serializeValues(Writer& writer, const double* const values, const std::size_t count) = 0;
+    virtual void serializeArrayLength(Writer& writer, const std::size_t length) = 0;
+    virtual void serializeOptionalStart(Writer& writer, const bool hasValue) = 0;
+
+    virtual void serializeTypeInt(Writer& writer) = 0;
+    virtual void serializeTypeChar(Writer& writer) = 0;
+    virtual void serializeTypeBool(Writer& writer) = 0;
+    virtual void serializeTypeString(Writer& writer) = 0;
+    virtual void serializeTypeInt8(Writer& writer) = 0;
+    virtual void serializeTypeUInt8(Writer& writer) = 0;
+    virtual void serializeTypeInt16(Writer& writer) = 0;
+    virtual void serializeTypeUInt16(Writer& writer) = 0;
+    virtual void serializeTypeUInt32(Writer& writer) = 0;
+    virtual void serializeTypeInt64(Writer& writer) = 0;
+    virtual void serializeTypeUInt64(Writer& writer) = 0;
+    virtual void serializeTypeFloat(Writer& writer) = 0;
+    virtual void serializeTypeDouble(Writer& writer) = 0;
+    virtual void serializeTypeSequenceStart(Writer& writer, const bool isFixed, const std::size_t length) = 0;
+    virtual void serializeTypeSequenceEnd(Writer& writer) = 0;
+    virtual void serializeTypeOptionalStart(Writer& writer) = 0;
+    virtual void serializeTypeOptionalEnd(Writer& writer) = 0;
 
     virtual const char* const getClassNameFieldName() { return nullptr; }
     virtual const char* const getMembersFieldName() { return nullptr; }
@@ -89,70 +149,87 @@ protected:
     virtual const char* const getFunctionArgumentsFieldName() { return nullptr; }
 
 private:
+    template <class SerializeableT>
+    void serializeMembers(Writer& writer, const SerializeableT& object);
+
+    template <class SequenceT>
+    void serializeSequence(Writer& writer, const SequenceT& sequence);
+
+    template <class OptionalT>
+    void serializeOptional(Writer& writer, const OptionalT& optional);
+
     template <class SerializeableT, class MemberT>
     void serializeMember(
-        std::ostream& os,
+        Writer& writer,
         const MemberDescriptor<SerializeableT, MemberT>& descriptor,
         const SerializeableT& object,
         bool& firstMember);
 
     template <class SerializeableT, class ReturnT, class... ArgTs>
     void serializeMember(
-        std::ostream& os,
+        Writer& writer,
         const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
         const SerializeableT& object,
         bool& firstMember);
 
     template <class MemberT,
-        typename std::enable_if_t<
-            !std::is_same_v<char, MemberT> &&
-            !std::is_same_v<int, MemberT> &&
-            !std::is_same_v<const char*, MemberT> &&
-            !std::is_same_v<bool, MemberT>, int>  = 0>
-    void serializeType(std::ostream& os);
+        typename std::enable_if_t<TypeTraits::isDescribed<MemberT>, int>  = 0>
+    void serializeType(Writer& writer);
 
     template <class MemberT,
         typename std::enable_if_t<std::is_same_v<char, MemberT>, int> = 0>
-    void serializeType(std::ostream& os);
+    void serializeType(Writer& writer);
 
     template <class MemberT,
-        typename std::enable_if_t<std::is_same_v<int, MemberT>, int> = 0>
-    void serializeType(std::ostream& os);
+        typename std::enable_if_t<TypeTraits::isInteger<MemberT> || TypeTraits::isFloatingPoint<MemberT>, int> = 0>
+    void serializeType(Writer& writer);
 
     template <class MemberT,
         typename std::enable_if_t<std::is_same_v<const char*, MemberT>, int> = 0>
-    void serializeType(std::ostream& os);
+    void serializeType(Writer& writer);
 
     template <class MemberT,
         typename std::enable_if_t<std::is_same_v<bool, MemberT>, int> = 0>
-    void serializeType(std::ostream& os);
+    void serializeType(Writer& writer);
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isString<MemberT>, int> = 0>
+    void serializeType(Writer& writer);
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isSequence<MemberT>, int> = 0>
+    void serializeType(Writer& writer);
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isOptional<MemberT>, int> = 0>
+    void serializeType(Writer& writer);
 
     template <class SerializeableT, class MemberT>
     void serializeMemberDescriptors(
-        std::ostream& os,
+        Writer& writer,
         const MemberDescriptor<SerializeableT, MemberT>& descriptor,
         bool& firstDescriptor);
 
     template <class SerializeableT, class ReturnT, class... ArgTs>
     void serializeMemberDescriptors(
-        std::ostream& os,
+        Writer& writer,
         const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
         bool& firstDescriptor);
 
     template <class SerializeableT, class MemberT>
     void serializeFunctionDescriptors(
-        std::ostream& os,
+        Writer& writer,
         const MemberDescriptor<SerializeableT, MemberT>& descriptor,
         bool& firstDescriptor);
 
     template <class SerializeableT, class ReturnT, class... ArgTs>
     void serializeFunctionDescriptors(
-        std::ostream& os,
+        Writer& writer,
         const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
         bool& firstDescriptor);
 
     template <class ArgT>
-    void serializeFunctionArgument(std::ostream& os, const char* const name, bool& firstElement);
+    void serializeFunctionArgument(Writer& writer, const char* const name, bool& firstElement);
 };
 } // Serial
 
@@ -0,0 +1,534 @@
+/**
+ * @file SerializerBinary.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compact fixed layout binary serializer
+ * @version 1.0
+ * @date 2020-08-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __SERIALIZERBINARY_H__
+#define __SERIALIZERBINARY_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class BinarySerializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryEncoding.h"
+#include "Instrumentation.h"
+#include "Serializer.h"
+#include "StreamWriter.h"
+#include "Writer.h"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief compact fixed layout binary serializer
+ *
+ * @details Writes no names, seperators or brackets, only the values in
+ * the order of makeClassDescriptor(...). Reader and writer need the same
+ * descriptor. See BinaryEncoding for the layout:
+ * int 4 bytes, char and bool 1 byte, strings a 4 byte length and the characters.
+ * Other integers take their size, float and double their IEEE 754 bit pattern.
+ * std::vector has a 4 byte element count, std::array none, std::optional
+ * a byte telling whether the value follows.
+ * The structure is the class name followed by one type tag per member
+ * and function argument, nested classes are inlined.
+ * Objects whose memory equals the encoding (BinaryEncoding::isBulkEncodable())
+ * are written with a single copy instead of one hook call per member.
+ * Strings and containers have to be shorter than 4 GiB or 2^32 elements,
+ * longer ones fail an assertion instead of wrapping the length.
+ */
+class BinarySerializer : public Serializer
+{
+    // delete default constructors
+    BinarySerializer(const BinarySerializer& other) = delete;
+    BinarySerializer& operator=(const BinarySerializer& other) = delete;
+public:
+    BinarySerializer(){}
+
+    using Serializer::serializeStructure;
+
+    /**
+     * @brief Serializes any serializeable object or primitive.
+     *
+     * @tparam SerializeableT any serializeable type
+     * @param writer writer to write to
+     * @param object object to serialize
+     */
+    template <class SerializeableT>
+    void serialize(Writer& writer, const SerializeableT& object)
+    {
+        if constexpr (BinaryEncoding::isBulkEncodable<SerializeableT>() && TypeTraits::isDescribed<SerializeableT>) {
+            Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, writer.getPosition());
+            writer.write(reinterpret_cast<const char*>(&object), sizeof(SerializeableT));
+            scope.finish(writer.getPosition());
+        } else if constexpr (BinaryEncoding::isBulkEncodable<SerializeableT>()) {
+            writer.write(reinterpret_cast<const char*>(&object), sizeof(SerializeableT));
+        } else {
+            Serializer::serialize(writer, object);
+        }
+    }
+
+    template <class SerializeableT>
+    void serialize(std::ostream& os, const SerializeableT& object)
+    {
+        StreamWriter writer(os);
+        serialize(writer, object);
+    }
+
+    /**
+     * @brief number of bytes serialize(...) writes for a value, without writing it.
+     *
+     * @details The bytes that only depend on the type are summed up at
+     * compile time (BinaryEncoding::fixedSize()), only strings, vectors
+     * and optionals are looked at.
+     *
+     * @tparam SerializeableT any serializeable type
+     * @param value value to measure
+     * @return std::size_t exact size of the output
+     */
+    template <class SerializeableT>
+    static std::size_t serializedSize(const SerializeableT& value)
+    {
+        return BinaryEncoding::fixedSize<SerializeableT>() + variableSize(value);
+    }
+
+    /**
+     * @brief Serializes consecutive objects without anything in between.
+     *
+     * @details Described objects that are copied as a whole are
+     * instrumented as count calls of serialize(...) sharing the time of
+     * the single copy.
+     *
+     * @tparam SerializeableT any serializeable type
+     * @param writer writer to write to
+     * @param objects first object
+     * @param count number of objects
+     */
+    template <class SerializeableT>
+    void serializeArray(Writer& writer, const SerializeableT* const objects, const std::size_t count)
+    {
+        if constexpr (BinaryEncoding::isBulkEncodable<SerializeableT>() && TypeTraits::isDescribed<SerializeableT>) {
+            Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, writer.getPosition());
+            writer.write(reinterpret_cast<const char*>(objects), count * sizeof(SerializeableT));
+            scope.finish(writer.getPosition(), count);
+        } else if constexpr (BinaryEncoding::isBulkEncodable<SerializeableT>()) {
+            writer.write(reinterpret_cast<const char*>(objects), count * sizeof(SerializeableT));
+        } else {
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                Serializer::serialize(writer, objects[ii]);
+            }
+        }
+    }
+
+    /**
+     * @brief Serializes a range of objects, contiguous ranges of objects
+     * that can be copied as a whole are written with a single copy.
+     *
+     * @tparam IteratorT input iterator to serializeable objects
+     * @param writer writer to write to
+     * @param first first element
+     * @param last end of the range
+     */
+    template <class IteratorT>
+    void serializeRange(Writer& writer, IteratorT first, const IteratorT last)
+    {
+        using SerializeableT = std::remove_cv_t<std::remove_reference_t<decltype(*first)>>;
+        if constexpr (BinaryEncoding::isBulkEncodable<SerializeableT>() && std::contiguous_iterator<IteratorT>) {
+            serializeArray(writer, std::to_address(first), last - first);
+        } else {
+            Serializer::serializeRange(writer, first, last);
+        }
+    }
+
+    /**
+     * @brief Serializes a consecutive part of a range, see Serializer::serializeRangePart(...)
+     */
+    template <class IteratorT>
+    void serializeRangePart(
+        Writer& writer,
+        IteratorT first,
+        const IteratorT last,
+        const bool isFirstPart,
+        const bool isLastPart)
+    {
+        using SerializeableT = std::remove_cv_t<std::remove_reference_t<decltype(*first)>>;
+        if constexpr (BinaryEncoding::isBulkEncodable<SerializeableT>() && std::contiguous_iterator<IteratorT>) {
+            serializeArray(writer, std::to_address(first), last - first);
+        } else {
+            Serializer::serializeRangePart(writer, first, last, isFirstPart, isLastPart);
+        }
+    }
+
+    template <class RangeT>
+    void serializeRange(Writer& writer, const RangeT& range)
+    {
+        serializeRange(writer, std::begin(range), std::end(range));
+    }
+
+    template <class RangeT>
+    void serializeRange(std::ostream& os, const RangeT& range)
+    {
+        StreamWriter writer(os);
+        serializeRange(writer, std::begin(range), std::end(range));
+    }
+
+protected:
+    virtual void serializeObjectStart(Writer& writer) override
+    {
+    }
+
+    virtual void serializeObjectEnd(Writer& writer) override
+    {
+    }
+
+    virtual void serializeArrayStart(Writer& writer) override
+    {
+    }
+
+    virtual void serializeArrayEnd(Writer& writer) override
+    {
+    }
+
+    virtual void serializeName(Writer& writer, const char* const name) override
+    {
+    }
+
+    virtual void serializeSeperator(Writer& writer) override
+    {
+    }
+
+    virtual void serializeValue(Writer& writer, const int& value) override
+    {
+        BinaryEncoding::write(writer, static_cast<BinaryEncoding::IntType>(value));
+    }
+
+    virtual void serializeValue(Writer& writer, const char& value) override
+    {
+        writer.write(value);
+    }
+
+    virtual void serializeValue(Writer& writer, const bool& value) override
+    {
+        writer.write(value ? '\1' : '\0');
+    }
+
+    virtual void serializeValue(Writer& writer, const std::int8_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint8_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::int16_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint16_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint32_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::int64_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint64_t& value) override
+    {
+        BinaryEncoding::write(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const float& value) override
+    {
+        BinaryEncoding::write(writer, std::bit_cast<std::uint32_t>(value));
+    }
+
+    virtual void serializeValue(Writer& writer, const double& value) override
+    {
+        BinaryEncoding::write(writer, std::bit_cast<std::uint64_t>(value));
+    }
+
+    virtual void serializeValue(Writer& writer, const char* const value) override
+    {
+        serializeValue(writer, value, std::strlen(value));
+    }
+
+    virtual void serializeValue(Writer& writer, const char* const value, const std::size_t length) override
+    {
+        BinaryEncoding::writeLength(writer, length);
+        writer.write(value, length);
+    }
+
+    virtual void serializeValues(Writer& writer, const int* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const char* const values, const std::size_t count) override
+    {
+        writer.write(values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const bool* const values, const std::size_t count) override
+    {
+        if constexpr (BinaryEncoding::isBulkEncodable<bool>()) {
+            writer.write(reinterpret_cast<const char*>(values), count);
+        } else {
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                writer.write(values[ii] ? '\1' : '\0');
+            }
+        }
+    }
+
+    virtual void serializeValues(Writer& writer, const std::int8_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint8_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::int16_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint16_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint32_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::int64_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint64_t* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const float* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const double* const values, const std::size_t count) override
+    {
+        writeValues(writer, values, count);
+    }
+
+    virtual void serializeArrayLength(Writer& writer, const std::size_t length) override
+    {
+        BinaryEncoding::writeLength(writer, length);
+    }
+
+    virtual void serializeOptionalStart(Writer& writer, const bool hasValue) override
+    {
+        writer.write(hasValue ? '\1' : '\0');
+    }
+
+    virtual void serializeTypeChar(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeChar);
+    }
+
+    virtual void serializeTypeInt(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeInt);
+    }
+
+    virtual void serializeTypeString(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeString);
+    }
+
+    virtual void serializeTypeBool(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeBool);
+    }
+
+    virtual void serializeTypeInt8(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeInt8);
+    }
+
+    virtual void serializeTypeUInt8(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeUInt8);
+    }
+
+    virtual void serializeTypeInt16(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeInt16);
+    }
+
+    virtual void serializeTypeUInt16(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeUInt16);
+    }
+
+    virtual void serializeTypeUInt32(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeUInt32);
+    }
+
+    virtual void serializeTypeInt64(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeInt64);
+    }
+
+    virtual void serializeTypeUInt64(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeUInt64);
+    }
+
+    virtual void serializeTypeFloat(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeFloat);
+    }
+
+    virtual void serializeTypeDouble(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeDouble);
+    }
+
+    virtual void serializeTypeSequenceStart(Writer& writer, const bool isFixed, const std::size_t length) override
+    {
+        if (isFixed) {
+            writer.write(BinaryEncoding::typeArray);
+            BinaryEncoding::writeLength(writer, length);
+        } else {
+            writer.write(BinaryEncoding::typeVector);
+        }
+    }
+
+    virtual void serializeTypeSequenceEnd(Writer& writer) override
+    {
+    }
+
+    virtual void serializeTypeOptionalStart(Writer& writer) override
+    {
+        writer.write(BinaryEncoding::typeOptional);
+    }
+
+    virtual void serializeTypeOptionalEnd(Writer& writer) override
+    {
+    }
+
+private:
+    /**
+     * @brief writes consecutive numbers, with a single copy if their memory equals the encoding
+     *
+     * @tparam NumberT integer or floating point type
+     * @param writer writer to write to
+     * @param values first number
+     * @param count number of values
+     */
+    template <class NumberT>
+    void writeValues(Writer& writer, const NumberT* const values, const std::size_t count)
+    {
+        if constexpr (BinaryEncoding::isBulkEncodable<NumberT>()) {
+            writer.write(reinterpret_cast<const char*>(values), count * sizeof(NumberT));
+        } else {
+            for (std::size_t ii = 0; ii < count; ++ii) {
+                serializeValue(writer, values[ii]);
+            }
+        }
+    }
+
+    /**
+     * @brief bytes of a value on top of BinaryEncoding::fixedSize()
+     *
+     * @tparam ValueT any serializeable type
+     * @param value value to measure
+     * @return std::size_t bytes depending on the content
+     */
+    template <class ValueT>
+    static std::size_t variableSize(const ValueT& value)
+    {
+        if constexpr (BinaryEncoding::isFixedSize<ValueT>()) {
+            return 0;
+        } else if constexpr (std::is_same_v<const char*, ValueT>) {
+            return std::strlen(value);
+        } else if constexpr (TypeTraits::isString<ValueT>) {
+            return value.size();
+        } else if constexpr (TypeTraits::isSequence<ValueT>) {
+            using ElementT = typename ValueT::value_type;
+            // the elements of a std::array are part of its fixed size already
+            std::size_t size = TypeTraits::isFixedSequence<ValueT> ? 0 : value.size() * BinaryEncoding::fixedSize<ElementT>();
+            if constexpr (!BinaryEncoding::isFixedSize<ElementT>()) {
+                for (const ElementT& element : value) {
+                    size += variableSize(element);
+                }
+            }
+            return size;
+        } else if constexpr (TypeTraits::isOptional<ValueT>) {
+            return value.has_value() ? serializedSize(*value) : 0;
+        } else {
+            return variableMembersSize(value, std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+        }
+    }
+
+    template <class SerializeableT, std::size_t... Indices>
+    static std::size_t variableMembersSize(const SerializeableT& object, std::index_sequence<Indices...>)
+    {
+        return (std::size_t(0) + ... + variableMemberSize(object, Descriptor::getDescriptor<SerializeableT, Indices>()));
+    }
+
+    template <class SerializeableT, class MemberT>
+    static std::size_t variableMemberSize(
+        const SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+    {
+        return variableSize(descriptor.getMemberValue(object));
+    }
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static std::size_t variableMemberSize(
+        const SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+    {
+        return 0;
+    }
+};
+} // Serialization
+#endif //__SERIALIZERBINARY_H__
@@ -0,0 +1,269 @@
+/**
+ * @file SerializerDelta.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writes only the members that differ from a baseline
+ * @version 1.0
+ * @date 2020-08-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __SERIALIZERDELTA_H__
+#define __SERIALIZERDELTA_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class DeltaSerializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "SerializerBinary.h"
+#include "StreamWriter.h"
+#include "TypeTraits.h"
+#include "Writer.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief writes only the members that differ from a baseline
+ *
+ * @details Compares an object to a baseline member by member and writes
+ * a bitmask with one bit per member variable (functions have none), least
+ * significant bit of the first byte for the first member, followed by the
+ * changed members in descriptor order. Nested described members are
+ * written as delta again, everything else with BinarySerializer.
+ * Const members can not be applied and are never written.
+ * DeltaDeserializer applies the delta to the same baseline on the other side.
+ */
+class DeltaSerializer
+{
+    // delete default constructors
+    DeltaSerializer(const DeltaSerializer& other) = delete;
+    DeltaSerializer& operator=(const DeltaSerializer& other) = delete;
+public:
+    DeltaSerializer(){}
+
+    /**
+     * @brief Serializes the difference between object and baseline.
+     *
+     * @tparam SerializeableT any class with static descriptor
+     * @param writer writer to write to
+     * @param object current state
+     * @param baseline state the receiver has
+     */
+    template <class SerializeableT>
+    void serialize(Writer& writer, const SerializeableT& object, const SerializeableT& baseline)
+    {
+        static_assert(TypeTraits::isDescribed<SerializeableT>, "deltas are made of described classes");
+        Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, writer.getPosition());
+        writeDelta(writer, object, baseline);
+        scope.finish(writer.getPosition());
+    }
+
+    template <class SerializeableT>
+    void serialize(std::ostream& os, const SerializeableT& object, const SerializeableT& baseline)
+    {
+        StreamWriter writer(os);
+        serialize(writer, object, baseline);
+    }
+
+    /**
+     * @brief bytes of the bitmask in front of the members of a class
+     *
+     * @tparam SerializeableT any class with static descriptor
+     * @return constexpr std::size_t one bit per member variable, rounded up to bytes
+     */
+    template <class SerializeableT>
+    static constexpr std::size_t maskSize()
+    {
+        return (Descriptor::getMemberCount<SerializeableT>() + 7) / 8;
+    }
+
+    /**
+     * @brief compares two values the way they are encoded.
+     *
+     * @details Described classes are compared member by member, so they
+     * need no operator==. Floating points compare their bits, a NaN equals
+     * itself and 0.0 differs from -0.0.
+     *
+     * @tparam ValueT any serializeable type
+     * @param first first value
+     * @param second second value
+     * @return true if both are written the same
+     */
+    template <class ValueT>
+    static bool isEqual(const ValueT& first, const ValueT& second)
+    {
+        if constexpr (std::is_same_v<float, ValueT>) {
+            return std::bit_cast<std::uint32_t>(first) == std::bit_cast<std::uint32_t>(second);
+        } else if constexpr (std::is_same_v<double, ValueT>) {
+            return std::bit_cast<std::uint64_t>(first) == std::bit_cast<std::uint64_t>(second);
+        } else if constexpr (std::is_same_v<const char*, ValueT>) {
+            return (first == second) || ((first != nullptr) && (second != nullptr) && (std::strcmp(first, second) == 0));
+        } else if constexpr (TypeTraits::isSequence<ValueT>) {
+            using ElementT = typename ValueT::value_type;
+            if constexpr (TypeTraits::isBulkSequence<ValueT> && !TypeTraits::isFloatingPoint<ElementT>) {
+                return first == second;
+            } else {
+                return std::equal(std::begin(first), std::end(first), std::begin(second), std::end(second),
+                    [](const ElementT& left, const ElementT& right) { return isEqual(left, right); });
+            }
+        } else if constexpr (TypeTraits::isOptional<ValueT>) {
+            return (first.has_value() == second.has_value()) && (!first.has_value() || isEqual(*first, *second));
+        } else if constexpr (TypeTraits::isDescribed<ValueT>) {
+            return membersEqual(first, second, std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+        } else {
+            return first == second;
+        }
+    }
+
+private:
+    /**
+     * @brief writes bitmask and changed members of a described class
+     *
+     * @details Nested members are compared once here to set their bit
+     * and once more when their own delta is written.
+     *
+     * @tparam SerializeableT any class with static descriptor
+     * @param writer writer to write to
+     * @param object current state
+     * @param baseline state the receiver has
+     */
+    template <class SerializeableT>
+    void writeDelta(Writer& writer, const SerializeableT& object, const SerializeableT& baseline)
+    {
+        constexpr auto indices = std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>();
+
+        std::array<char, maskSize<SerializeableT>()> mask{};
+        markChanges(mask, object, baseline, indices);
+        writer.write(mask.data(), mask.size());
+        writeChanges(writer, mask, object, baseline, indices);
+    }
+
+    template <class SerializeableT, std::size_t MaskSize, std::size_t... Indices>
+    static void markChanges(
+        std::array<char, MaskSize>& mask,
+        const SerializeableT& object,
+        const SerializeableT& baseline,
+        std::index_sequence<Indices...>)
+    {
+        (markChange<Indices>(mask, object, baseline, Descriptor::getDescriptor<SerializeableT, Indices>()), ...);
+    }
+
+    template <std::size_t Index, class SerializeableT, class MemberT, std::size_t MaskSize>
+    static void markChange(
+        std::array<char, MaskSize>& mask,
+        const SerializeableT& object,
+        const SerializeableT& baseline,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+    {
+        constexpr std::size_t bit = Descriptor::getMemberPosition<SerializeableT, Index>();
+
+        if constexpr (MemberDescriptor<SerializeableT, MemberT>::isWriteable) {
+            if (!isEqual(descriptor.getMemberValue(object), descriptor.getMemberValue(baseline))) {
+                mask[bit / 8] = static_cast<char>(mask[bit / 8] | (1 << (bit % 8)));
+            }
+        }
+    }
+
+    template <std::size_t Index, class SerializeableT, class ReturnT, class... ArgTs, std::size_t MaskSize>
+    static void markChange(
+        std::array<char, MaskSize>& mask,
+        const SerializeableT& object,
+        const SerializeableT& baseline,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+    {
+    }
+
+    template <class SerializeableT, std::size_t MaskSize, std::size_t... Indices>
+    void writeChanges(
+        Writer& writer,
+        const std::array<char, MaskSize>& mask,
+        const SerializeableT& object,
+        const SerializeableT& baseline,
+        std::index_sequence<Indices...>)
+    {
+        (writeChange<Indices>(writer, mask, object, baseline, Descriptor::getDescriptor<SerializeableT, Indices>()), ...);
+    }
+
+    template <std::size_t Index, class SerializeableT, class MemberT, std::size_t MaskSize>
+    void writeChange(
+        Writer& writer,
+        const std::array<char, MaskSize>& mask,
+        const SerializeableT& object,
+        const SerializeableT& baseline,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+    {
+        using ValueType = typename MemberDescriptor<SerializeableT, MemberT>::ValueType;
+        constexpr std::size_t bit = Descriptor::getMemberPosition<SerializeableT, Index>();
+
+        if ((static_cast<unsigned char>(mask[bit / 8]) & (1 << (bit % 8))) == 0) {
+            return;
+        }
+        if constexpr (TypeTraits::isDescribed<ValueType>) {
+            writeDelta(writer, descriptor.getMemberValue(object), descriptor.getMemberValue(baseline));
+        } else {
+            values.serialize(writer, descriptor.getMemberValue(object));
+        }
+    }
+
+    template <std::size_t Index, class SerializeableT, class ReturnT, class... ArgTs, std::size_t MaskSize>
+    void writeChange(
+        Writer& writer,
+        const std::array<char, MaskSize>& mask,
+        const SerializeableT& object,
+        const SerializeableT& baseline,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+    {
+    }
+
+    template <class SerializeableT, std::size_t... Indices>
+    static bool membersEqual(const SerializeableT& first, const SerializeableT& second, std::index_sequence<Indices...>)
+    {
+        return (memberEqual(first, second, Descriptor::getDescriptor<SerializeableT, Indices>()) && ...);
+    }
+
+    template <class SerializeableT, class MemberT>
+    static bool memberEqual(
+        const SerializeableT& first,
+        const SerializeableT& second,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+    {
+        return isEqual(descriptor.getMemberValue(first), descriptor.getMemberValue(second));
+    }
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static bool memberEqual(
+        const SerializeableT& first,
+        const SerializeableT& second,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+    {
+        return true;
+    }
+
+    /** writes the changed values */
+    BinarySerializer values;
+};
+} // Serialization
+#endif //__SERIALIZERDELTA_H__
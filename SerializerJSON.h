@@ -21,7 +21,13 @@ class JSONSerializer;
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include "IntegerFormatter.h"
+#include "JSONEscaper.h"
 #include "Serializer.h"
+#include "StaticSerializerJSON.h"
+#include "Writer.h"
+#include <cstddef>
+#include <cstring>
 
 namespace Serialization
 {
@@ -40,75 +46,288 @@ class JSONSerializer : public Serializer
 public:
     JSONSerializer(){}
 
+    /**
+     * @brief number of bytes serialize(...) writes for a value, without writing it.
+     *
+     * @details The output equals the one of StaticJSONSerializer, which
+     * sums up brackets and keys at compile time.
+     *
+     * @tparam SerializeableT any serializeable type
+     * @param value value to measure
+     * @return std::size_t exact size of the output
+     */
+    template <class SerializeableT>
+    static std::size_t serializedSize(const SerializeableT& value)
+    {
+        return StaticJSONSerializer::serializedSize(value);
+    }
+
 protected:
-    virtual void serializeObjectStart(std::ostream& os) override
+    virtual void serializeObjectStart(Writer& writer) override
     {
-        os << "{";
+        writer.write('{');
     }
 
-    virtual void serializeObjectEnd(std::ostream& os) override
+    virtual void serializeObjectEnd(Writer& writer) override
     {
-        os << "}";
+        writer.write('}');
     }
 
-    virtual void serializeArrayStart(std::ostream& os) override
+    virtual void serializeArrayStart(Writer& writer) override
     {
-        os << "[";
+        writer.write('[');
     }
     
-    virtual void serializeArrayEnd(std::ostream& os) override
+    virtual void serializeArrayEnd(Writer& writer) override
+    {
+        writer.write(']');
+    }
+
+    virtual void serializeName(Writer& writer, const char* const name) override
+    {
+        writer.write('"');
+        writer.write(name, std::strlen(name));
+        writer.write("\":", 2);
+    }
+
+    virtual void serializeSeperator(Writer& writer) override
+    {
+        writer.write(',');
+    }
+
+    virtual void serializeValue(Writer& writer, const int& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const char& value) override
+    {
+        writer.write('"');
+        JSONEscaper::write(writer, value);
+        writer.write('"');
+    }
+
+    virtual void serializeValue(Writer& writer, const bool& value) override
+    {
+        if (value) {
+            writer.write("true", 4);
+        } else {
+            writer.write("false", 5);
+        }
+    }
+
+    virtual void serializeValue(Writer& writer, const std::int8_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint8_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::int16_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint16_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint32_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::int64_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const std::uint64_t& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const float& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const double& value) override
+    {
+        StaticJSONSerializer::writeNumber(writer, value);
+    }
+
+    virtual void serializeValue(Writer& writer, const char* const value) override
+    {
+        serializeValue(writer, value, std::strlen(value));
+    }
+
+    virtual void serializeValue(Writer& writer, const char* const value, const std::size_t length) override
+    {
+        writer.write('"');
+        JSONEscaper::write(writer, value, length);
+        writer.write('"');
+    }
+
+    virtual void serializeValues(Writer& writer, const int* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const char* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const bool* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::int8_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint8_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::int16_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint16_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint32_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::int64_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const std::uint64_t* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const float* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeValues(Writer& writer, const double* const values, const std::size_t count) override
+    {
+        StaticJSONSerializer::writeValues(writer, values, count);
+    }
+
+    virtual void serializeArrayLength(Writer& writer, const std::size_t length) override
+    {
+        // json arrays are terminated instead
+    }
+
+    virtual void serializeOptionalStart(Writer& writer, const bool hasValue) override
+    {
+        if (!hasValue) {
+            writer.write("null", 4);
+        }
+    }
+
+    virtual void serializeTypeChar(Writer& writer) override
+    {
+        writer.write("\"CHAR\"", 6);
+    }
+
+    virtual void serializeTypeInt(Writer& writer) override
+    {
+        writer.write("\"INT\"", 5);
+    }
+
+    virtual void serializeTypeString(Writer& writer) override
+    {
+        writer.write("\"STRING\"", 8);
+    }
+
+    virtual void serializeTypeBool(Writer& writer) override
+    {
+        writer.write("\"BOOLEAN\"", 9);
+    }
+
+    virtual void serializeTypeInt8(Writer& writer) override
+    {
+        writer.write("\"INT8\"", 6);
+    }
+
+    virtual void serializeTypeUInt8(Writer& writer) override
+    {
+        writer.write("\"UINT8\"", 7);
+    }
+
+    virtual void serializeTypeInt16(Writer& writer) override
     {
-        os << "]";
+        writer.write("\"INT16\"", 7);
     }
 
-    virtual void serializeName(std::ostream& os, const char* const name) override
+    virtual void serializeTypeUInt16(Writer& writer) override
     {
-        os << "\"" << name << "\":";
+        writer.write("\"UINT16\"", 8);
     }
 
-    virtual void serializeSeperator(std::ostream& os) override
+    virtual void serializeTypeUInt32(Writer& writer) override
     {
-        os << ",";
+        writer.write("\"UINT32\"", 8);
     }
 
-    virtual void serializeValue(std::ostream& os, const int& value) override
+    virtual void serializeTypeInt64(Writer& writer) override
     {
-        os << value;
+        writer.write("\"INT64\"", 7);
     }
 
-    virtual void serializeValue(std::ostream& os, const char& value) override
+    virtual void serializeTypeUInt64(Writer& writer) override
     {
-        os << value;
+        writer.write("\"UINT64\"", 8);
     }
 
-    virtual void serializeValue(std::ostream& os, const bool& value) override
+    virtual void serializeTypeFloat(Writer& writer) override
     {
-        os << (value ? "true" : "false");
+        writer.write("\"FLOAT\"", 7);
     }
 
-    virtual void serializeValue(std::ostream& os, const char* const value) override
+    virtual void serializeTypeDouble(Writer& writer) override
     {
-        os << "\"" << value << "\"";
+        writer.write("\"DOUBLE\"", 8);
     }
 
-    virtual void serializeTypeChar(std::ostream& os) override
+    virtual void serializeTypeSequenceStart(Writer& writer, const bool isFixed, const std::size_t length) override
     {
-        os << "\"CHAR\"";
+        writer.write('[');
     }
 
-    virtual void serializeTypeInt(std::ostream& os) override
+    virtual void serializeTypeSequenceEnd(Writer& writer) override
     {
-        os << "\"INT\"";
+        writer.write(']');
     }
 
-    virtual void serializeTypeString(std::ostream& os) override
+    virtual void serializeTypeOptionalStart(Writer& writer) override
     {
-        os << "\"STRING\"";
+        writer.write("{\"Optional\":", 12);
     }
 
-    virtual void serializeTypeBool(std::ostream& os) override
+    virtual void serializeTypeOptionalEnd(Writer& writer) override
     {
-        os << "\"BOOLEAN\"";
+        writer.write('}');
     }
 
     virtual const char* const getClassNameFieldName() override 
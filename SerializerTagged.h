@@ -0,0 +1,312 @@
+/**
+ * @file SerializerTagged.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief binary serializer identifying members by id
+ * @version 1.0
+ * @date 2020-08-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __SERIALIZERTAGGED_H__
+#define __SERIALIZERTAGGED_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class TaggedSerializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryEncoding.h"
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "StreamWriter.h"
+#include "TaggedEncoding.h"
+#include "TypeTraits.h"
+#include "Writer.h"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief binary serializer identifying members by id
+ *
+ * @details Writes every member as a field with a key of its id and wire
+ * type, see TaggedEncoding. Members can be added to and removed from the
+ * descriptor as long as ids are not reused: readers skip fields they do
+ * not know and keep members that are not in the input. Every member needs
+ * an id, given behind its name in makeClassDescriptor(...).
+ * Values are written like BinarySerializer, sequences of numbers whose
+ * memory equals the encoding with a single copy. The length of nested
+ * values is measured with serializedSize(...) before they are written.
+ */
+class TaggedSerializer
+{
+    // delete default constructors
+    TaggedSerializer(const TaggedSerializer& other) = delete;
+    TaggedSerializer& operator=(const TaggedSerializer& other) = delete;
+public:
+    TaggedSerializer(){}
+
+    /**
+     * @brief Serializes the fields of a described class.
+     *
+     * @tparam SerializeableT any class with static descriptor and member ids
+     * @param writer writer to write to
+     * @param object object to serialize
+     */
+    template <class SerializeableT>
+    void serialize(Writer& writer, const SerializeableT& object)
+    {
+        static_assert(TypeTraits::isDescribed<SerializeableT>, "the tagged format writes described classes");
+        Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, writer.getPosition());
+        writeContent(writer, object);
+        scope.finish(writer.getPosition());
+    }
+
+    template <class SerializeableT>
+    void serialize(std::ostream& os, const SerializeableT& object)
+    {
+        StreamWriter writer(os);
+        serialize(writer, object);
+    }
+
+    /**
+     * @brief number of bytes serialize(...) writes for an object, without writing it.
+     *
+     * @tparam SerializeableT any class with static descriptor and member ids
+     * @param object object to measure
+     * @return std::size_t exact size of the output
+     */
+    template <class SerializeableT>
+    static std::size_t serializedSize(const SerializeableT& object)
+    {
+        static_assert(TypeTraits::isDescribed<SerializeableT>, "the tagged format writes described classes");
+        return contentSize(object);
+    }
+
+private:
+    /**
+     * @brief writes key and value of a member, nothing for an empty std::optional
+     *
+     * @tparam ValueT any serializeable type
+     * @param writer writer to write to
+     * @param id id of the member
+     * @param value value of the member
+     */
+    template <class ValueT>
+    void writeField(Writer& writer, const std::uint32_t id, const ValueT& value)
+    {
+        if constexpr (TypeTraits::isOptional<ValueT>) {
+            if (value.has_value()) {
+                writeField(writer, id, *value);
+            }
+        } else {
+            TaggedEncoding::writeKey(writer, TaggedEncoding::makeKey(id, TaggedEncoding::wireType<ValueT>()));
+            writeValue(writer, value);
+        }
+    }
+
+    /**
+     * @brief writes a value without key, Length values with their length.
+     *
+     * @tparam ValueT any serializeable type except std::optional
+     * @param writer writer to write to
+     * @param value value to write
+     */
+    template <class ValueT>
+    void writeValue(Writer& writer, const ValueT& value)
+    {
+        if constexpr (std::is_same_v<char, ValueT>) {
+            writer.write(value);
+        } else if constexpr (std::is_same_v<bool, ValueT>) {
+            writer.write(value ? '\1' : '\0');
+        } else if constexpr (std::is_same_v<int, ValueT>) {
+            BinaryEncoding::write(writer, static_cast<BinaryEncoding::IntType>(value));
+        } else if constexpr (TypeTraits::isInteger<ValueT>) {
+            BinaryEncoding::write(writer, static_cast<TypeTraits::FixedWidthType<ValueT>>(value));
+        } else if constexpr (std::is_same_v<float, ValueT>) {
+            BinaryEncoding::write(writer, std::bit_cast<std::uint32_t>(value));
+        } else if constexpr (std::is_same_v<double, ValueT>) {
+            BinaryEncoding::write(writer, std::bit_cast<std::uint64_t>(value));
+        } else {
+            BinaryEncoding::writeLength(writer, contentSize(value));
+            writeContent(writer, value);
+        }
+    }
+
+    /**
+     * @brief writes an element of a sequence, std::optional with a presence byte.
+     *
+     * @tparam ElementT any serializeable type
+     * @param writer writer to write to
+     * @param element element to write
+     */
+    template <class ElementT>
+    void writeElement(Writer& writer, const ElementT& element)
+    {
+        if constexpr (TypeTraits::isOptional<ElementT>) {
+            writer.write(element.has_value() ? '\1' : '\0');
+            if (element.has_value()) {
+                writeElement(writer, *element);
+            }
+        } else {
+            writeValue(writer, element);
+        }
+    }
+
+    /**
+     * @brief writes what follows the length of a Length value
+     *
+     * @tparam ValueT string, sequence or described class
+     * @param writer writer to write to
+     * @param value value to write
+     */
+    template <class ValueT>
+    void writeContent(Writer& writer, const ValueT& value)
+    {
+        if constexpr (std::is_same_v<const char*, ValueT>) {
+            writer.write(value, std::strlen(value));
+        } else if constexpr (TypeTraits::isString<ValueT>) {
+            writer.write(value.data(), value.size());
+        } else if constexpr (TypeTraits::isSequence<ValueT>) {
+            using ElementT = typename ValueT::value_type;
+            if constexpr (TypeTraits::isBulkSequence<ValueT> && BinaryEncoding::isBulkEncodable<ElementT>()) {
+                writer.write(reinterpret_cast<const char*>(value.data()), value.size() * sizeof(ElementT));
+            } else {
+                for (const ElementT& element : value) {
+                    writeElement(writer, element);
+                }
+            }
+        } else {
+            static_assert(TaggedEncoding::hasValidIds<ValueT>(),
+                "every member needs a unique id above 0, e.g. &T::member, \"member\", 1");
+            writeMembers(writer, value, std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+        }
+    }
+
+    template <class SerializeableT, std::size_t... Indices>
+    void writeMembers(Writer& writer, const SerializeableT& object, std::index_sequence<Indices...>)
+    {
+        (writeMember(writer, object, Descriptor::getDescriptor<SerializeableT, Indices>()), ...);
+    }
+
+    template <class SerializeableT, class MemberT>
+    void writeMember(
+        Writer& writer,
+        const SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+    {
+        writeField(writer, descriptor.getId(), descriptor.getMemberValue(object));
+    }
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    void writeMember(
+        Writer& writer,
+        const SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+    {
+    }
+
+    template <class ValueT>
+    static std::size_t fieldSize(const std::uint32_t id, const ValueT& value)
+    {
+        if constexpr (TypeTraits::isOptional<ValueT>) {
+            return value.has_value() ? fieldSize(id, *value) : 0;
+        } else {
+            return TaggedEncoding::keySize(TaggedEncoding::makeKey(id, TaggedEncoding::wireType<ValueT>())) +
+                valueSize(value);
+        }
+    }
+
+    template <class ValueT>
+    static std::size_t valueSize(const ValueT& value)
+    {
+        if constexpr (TaggedEncoding::wireType<ValueT>() == TaggedEncoding::WireType::Length) {
+            return sizeof(BinaryEncoding::LengthType) + contentSize(value);
+        } else {
+            return TaggedEncoding::fixedSize(TaggedEncoding::wireType<ValueT>());
+        }
+    }
+
+    template <class ElementT>
+    static std::size_t elementSize(const ElementT& element)
+    {
+        if constexpr (TypeTraits::isOptional<ElementT>) {
+            return 1 + (element.has_value() ? elementSize(*element) : 0);
+        } else {
+            return valueSize(element);
+        }
+    }
+
+    /**
+     * @brief bytes behind the length of a Length value
+     *
+     * @tparam ValueT string, sequence or described class
+     * @param value value to measure
+     * @return std::size_t length written in front of the content
+     */
+    template <class ValueT>
+    static std::size_t contentSize(const ValueT& value)
+    {
+        if constexpr (std::is_same_v<const char*, ValueT>) {
+            return std::strlen(value);
+        } else if constexpr (TypeTraits::isString<ValueT>) {
+            return value.size();
+        } else if constexpr (TypeTraits::isSequence<ValueT>) {
+            using ElementT = typename ValueT::value_type;
+            if constexpr (TaggedEncoding::wireType<ElementT>() != TaggedEncoding::WireType::Length &&
+                !TypeTraits::isOptional<ElementT>) {
+                return value.size() * TaggedEncoding::fixedSize(TaggedEncoding::wireType<ElementT>());
+            } else {
+                std::size_t size = 0;
+                for (const ElementT& element : value) {
+                    size += elementSize(element);
+                }
+                return size;
+            }
+        } else {
+            return membersSize(value, std::make_index_sequence<Descriptor::getDescriptorCount<ValueT>()>());
+        }
+    }
+
+    template <class SerializeableT, std::size_t... Indices>
+    static std::size_t membersSize(const SerializeableT& object, std::index_sequence<Indices...>)
+    {
+        return (std::size_t(0) + ... + memberSize(object, Descriptor::getDescriptor<SerializeableT, Indices>()));
+    }
+
+    template <class SerializeableT, class MemberT>
+    static std::size_t memberSize(
+        const SerializeableT& object,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+    {
+        return fieldSize(descriptor.getId(), descriptor.getMemberValue(object));
+    }
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static std::size_t memberSize(
+        const SerializeableT& object,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+    {
+        return 0;
+    }
+};
+} // Serialization
+#endif //__SERIALIZERTAGGED_H__
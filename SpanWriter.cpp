@@ -0,0 +1,93 @@
+/**
+ * @file SpanWriter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writer into fixed memory, e.g. for embedded targets
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "SpanWriter.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a new Span Writer
+ *
+ * @param buffer memory to write to
+ * @param capacity size of buffer in bytes
+ */
+inline Serialization::SpanWriter::SpanWriter(char* const buffer, const std::size_t capacity) :
+    Writer(buffer, buffer + capacity), limit(buffer + capacity), overflowed(false)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief gets the written data, not zero terminated
+ *
+ * @return const char* first byte
+ */
+inline const char* Serialization::SpanWriter::getData() const
+{
+    return begin;
+}
+
+/**
+ * @brief gets the number of bytes written
+ *
+ * @return std::size_t number of bytes
+ */
+inline std::size_t Serialization::SpanWriter::getSize() const
+{
+    return cursor - begin;
+}
+
+/**
+ * @brief checks whether some output was dropped
+ *
+ * @return true if the output is incomplete
+ */
+inline bool Serialization::SpanWriter::hasOverflowed() const
+{
+    return overflowed;
+}
+
+/**
+ * @brief drops the written data and resets the overflow
+ */
+inline void Serialization::SpanWriter::clear()
+{
+    cursor = begin;
+    end = limit;
+    overflowed = false;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+inline void Serialization::SpanWriter::writeOverflow(const char* const data, const std::size_t size)
+{
+    // close the window, so no later write can succeed after a dropped one
+    end = cursor;
+    overflowed = true;
+}
+
+inline char* Serialization::SpanWriter::reserveOverflow(const std::size_t size)
+{
+    end = cursor;
+    overflowed = true;
+    return nullptr;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
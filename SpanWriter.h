@@ -0,0 +1,67 @@
+/**
+ * @file SpanWriter.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writer into fixed memory, e.g. for embedded targets
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __SPANWRITER_H__
+#define __SPANWRITER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class SpanWriter;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstddef>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief writer into fixed memory, e.g. for embedded targets
+ *
+ * @details Never allocates. If the output does not fit, the writer
+ * stops at the last complete write and reports the overflow.
+ */
+class SpanWriter : public Writer
+{
+    // delete default constructors
+    SpanWriter(const SpanWriter& other) = delete;
+    SpanWriter& operator=(const SpanWriter& other) = delete;
+public:
+    SpanWriter(char* const buffer, const std::size_t capacity);
+
+    const char* getData() const;
+    std::size_t getSize() const;
+    bool hasOverflowed() const;
+
+    void clear();
+
+protected:
+    virtual void writeOverflow(const char* const data, const std::size_t size) override;
+    virtual char* reserveOverflow(const std::size_t size) override;
+
+private:
+    /** end of the memory, the window is closed after an overflow */
+    char* const limit;
+    /** set once anything did not fit */
+    bool overflowed;
+};
+} // Serialization
+
+// include src
+#include "SpanWriter.cpp"
+#endif //__SPANWRITER_H__
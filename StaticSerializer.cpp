@@ -0,0 +1,777 @@
+/**
+ * @file StaticSerializer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief generic serializer for C++ classes with compile time format dispatch
+ * @version 1.0
+ * @date 2020-07-27
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "StaticSerializer.h"
+
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template <class FormatT>
+Serialization::StaticSerializer<FormatT>::StaticSerializer()
+{
+    // do nothing
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Serializes any object of a serializeable class.
+ *
+ * @details Same as Serializer::serialize(...), but every hook is
+ * resolved at compile time and each key is written as one precomputed
+ * fragment.
+ *
+ * @tparam SerializeableT any class with static descriptors tuple.
+ * @param writer writer to write to
+ * @param object object to serialize
+ */
+template <class FormatT>
+template <class SerializeableT,
+        typename std::enable_if_t<Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+void Serialization::StaticSerializer<FormatT>::serialize(Writer& writer, const SerializeableT& object)
+{
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, writer.getPosition());
+    format().serializeObjectStart(writer);
+    serializeMembers(
+        writer,
+        object,
+        std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+    format().serializeObjectEnd(writer);
+    scope.finish(writer.getPosition());
+}
+
+/**
+ * @brief Serializes primitive types, strings, sequences and optionals.
+ *
+ * @tparam SerializeableT any type but described classes
+ * @param writer writer to write to
+ * @param value value to serialize
+ */
+template <class FormatT>
+template <class SerializeableT,
+    typename std::enable_if_t<!Serialization::TypeTraits::isDescribed<SerializeableT>, int>>
+void Serialization::StaticSerializer<FormatT>::serialize(Writer& writer, const SerializeableT& value)
+{
+    if constexpr (TypeTraits::isString<SerializeableT>) {
+        format().serializeValue(writer, value.data(), value.size());
+    } else if constexpr (TypeTraits::isSequence<SerializeableT>) {
+        serializeSequence(writer, value);
+    } else if constexpr (TypeTraits::isOptional<SerializeableT>) {
+        serializeOptional(writer, value);
+    } else {
+        format().serializeValue(writer, value);
+    }
+}
+
+/**
+ * @brief Serializes an object to a stream.
+ *
+ * @details Adapter for the std::ostream interface, the output is
+ * collected by a StreamWriter and handed to the stream in blocks.
+ *
+ * @tparam SerializeableT any serializeable type
+ * @param os out stream to write to
+ * @param object object to serialize
+ */
+template <class FormatT>
+template <class SerializeableT>
+void Serialization::StaticSerializer<FormatT>::serialize(std::ostream& os, const SerializeableT& object)
+{
+    StreamWriter writer(os);
+    serialize(writer, object);
+}
+
+/**
+ * @brief Serializes a range of objects as an array.
+ *
+ * @details Seperator and object start in front of each element are
+ * fused into one compile time fragment, see makeElementPrefix().
+ * Every element is instrumented as one call of serialize(...).
+ *
+ * @tparam IteratorT input iterator to serializeable objects
+ * @param writer writer to write to
+ * @param first first element
+ * @param last end of the range
+ */
+template <class FormatT>
+template <class IteratorT>
+void Serialization::StaticSerializer<FormatT>::serializeRange(Writer& writer, IteratorT first, const IteratorT last)
+{
+    serializeRangePart(writer, first, last, true, true);
+}
+
+/**
+ * @brief Serializes a consecutive part of an array.
+ *
+ * @details Concatenating the parts of a range in order gives the same
+ * output as serializeRange(...) for the whole range.
+ *
+ * @tparam IteratorT input iterator to serializeable objects
+ * @param writer writer to write to
+ * @param first first element of the part
+ * @param last end of the part
+ * @param isFirstPart the part starts the array, no seperator in front
+ * @param isLastPart the part ends the array
+ */
+template <class FormatT>
+template <class IteratorT>
+void Serialization::StaticSerializer<FormatT>::serializeRangePart(
+    Writer& writer,
+    IteratorT first,
+    const IteratorT last,
+    const bool isFirstPart,
+    const bool isLastPart)
+{
+    using SerializeableT = std::remove_cv_t<std::remove_reference_t<decltype(*first)>>;
+
+    constexpr const auto& prefix = elementPrefix<SerializeableT>;
+    constexpr std::size_t seperatorLength = FormatT::seperator.size();
+
+    if (isFirstPart) {
+        format().serializeArrayStart(writer);
+    }
+    // the first element of the array only gets the object start of the prefix
+    for (bool isFirstElement = isFirstPart; first != last; ++first, isFirstElement = false) {
+        // start of the element after its seperator, as serialize(...) would count it
+        std::size_t elementStart = writer.getPosition();
+        if (isFirstElement) {
+            writer.write(prefix.data() + seperatorLength, prefix.size() - seperatorLength);
+        } else {
+            elementStart += seperatorLength;
+            writer.write(prefix.data(), prefix.size());
+        }
+
+        if constexpr (TypeTraits::isDescribed<SerializeableT>) {
+            Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::Serialize, elementStart);
+            serializeMembers(
+                writer,
+                *first,
+                std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+            format().serializeObjectEnd(writer);
+            scope.finish(writer.getPosition());
+        } else {
+            serialize(writer, *first);
+        }
+    }
+    if (isLastPart) {
+        format().serializeArrayEnd(writer);
+    }
+}
+
+/**
+ * @brief Serializes a range of objects as an array.
+ *
+ * @tparam RangeT any range of serializeable objects, e.g. std::vector
+ * @param writer writer to write to
+ * @param range objects to serialize
+ */
+template <class FormatT>
+template <class RangeT>
+void Serialization::StaticSerializer<FormatT>::serializeRange(Writer& writer, const RangeT& range)
+{
+    serializeRange(writer, std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Serializes a range of objects as an array to a stream.
+ *
+ * @tparam RangeT any range of serializeable objects, e.g. std::vector
+ * @param os out stream to write to
+ * @param range objects to serialize
+ */
+template <class FormatT>
+template <class RangeT>
+void Serialization::StaticSerializer<FormatT>::serializeRange(std::ostream& os, const RangeT& range)
+{
+    StreamWriter writer(os);
+    serializeRange(writer, std::begin(range), std::end(range));
+}
+
+/**
+ * @brief number of bytes serialize(...) writes for a value, without writing it.
+ *
+ * @details Brackets, keys and seperators of a class only depend on
+ * its descriptor and are summed up at compile time (fixedSize).
+ * At runtime only the values are measured, e.g. digits of integers
+ * and escaped lengths of strings.
+ *
+ * @tparam SerializeableT any serializeable type
+ * @param value value to measure
+ * @return std::size_t exact size of the output
+ */
+template <class FormatT>
+template <class SerializeableT>
+std::size_t Serialization::StaticSerializer<FormatT>::serializedSize(const SerializeableT& value)
+{
+    if constexpr (TypeTraits::isDescribed<SerializeableT>) {
+        return fixedSize<SerializeableT> +
+            membersSize(value, std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+    } else if constexpr (TypeTraits::isString<SerializeableT>) {
+        return FormatT::valueSize(value.data(), value.size());
+    } else if constexpr (TypeTraits::isSequence<SerializeableT>) {
+        return sequenceSize(value);
+    } else if constexpr (TypeTraits::isOptional<SerializeableT>) {
+        return FormatT::optionalStartSize(value.has_value()) + (value.has_value() ? serializedSize(*value) : 0);
+    } else {
+        return FormatT::valueSize(value);
+    }
+}
+
+/**
+ * @brief Serializes the structure of an object.
+ *
+ * @details The document only depends on the type and is built at
+ * compile time, see makeStructure().
+ *
+ * @tparam SerializeableT type to write descriptor of
+ * @param writer writer to write to
+ */
+template <class FormatT>
+template <class SerializeableT>
+void Serialization::StaticSerializer<FormatT>::serializeStructure(Writer& writer)
+{
+    Instrumentation::Scope<SerializeableT> scope(InstrumentedOperation::SerializeStructure, writer.getPosition());
+    writer.write(structureDocument<SerializeableT>.data(), structureDocument<SerializeableT>.size());
+    scope.finish(writer.getPosition());
+}
+
+/**
+ * @brief Serializes the structure of an object to a stream.
+ *
+ * @tparam SerializeableT type to write descriptor of
+ * @param os stream to write the descriptor to
+ */
+template <class FormatT>
+template <class SerializeableT>
+void Serialization::StaticSerializer<FormatT>::serializeStructure(std::ostream& os)
+{
+    StreamWriter writer(os);
+    serializeStructure<SerializeableT>(writer);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief gets the format implementation of this serializer.
+ *
+ * @return FormatT& deriving class
+ */
+template <class FormatT>
+FormatT& Serialization::StaticSerializer<FormatT>::format()
+{
+    return static_cast<FormatT&>(*this);
+}
+
+/**
+ * @brief serializes every member descriptor of a class in order.
+ *
+ * @tparam SerializeableT
+ * @tparam Indices positions of all descriptors
+ * @param writer
+ * @param object
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t... Indices>
+void Serialization::StaticSerializer<FormatT>::serializeMembers(
+    Writer& writer,
+    const SerializeableT& object,
+    std::index_sequence<Indices...>)
+{
+    (serializeMember<SerializeableT, Indices>(writer, Descriptor::getDescriptor<SerializeableT, Indices>(), object), ...);
+}
+
+/**
+ * @brief serializes a std::vector or std::array as an array.
+ *
+ * @details Contiguous sequences of primitives are handed to a single
+ * serializeValues(...) call of the format.
+ *
+ * @tparam SequenceT std::vector or std::array
+ * @param writer writer to write to
+ * @param sequence elements to serialize
+ */
+template <class FormatT>
+template <class SequenceT>
+void Serialization::StaticSerializer<FormatT>::serializeSequence(Writer& writer, const SequenceT& sequence)
+{
+    if constexpr (!TypeTraits::isFixedSequence<SequenceT>) {
+        format().serializeArrayLength(writer, sequence.size());
+    }
+    format().serializeArrayStart(writer);
+    if constexpr (TypeTraits::isBulkSequence<SequenceT>) {
+        format().serializeValues(writer, sequence.data(), sequence.size());
+    } else {
+        using ElementT = typename SequenceT::value_type;
+        bool firstElement = true;
+        for (const auto& element : sequence) {
+            if (!firstElement) {
+                writer.write(FormatT::seperator.data(), FormatT::seperator.size());
+            } else {
+                firstElement = false;
+            }
+            serialize(writer, static_cast<const ElementT&>(element));
+        }
+    }
+    format().serializeArrayEnd(writer);
+}
+
+/**
+ * @brief serializes a std::optional, the format marks whether it has a value.
+ *
+ * @tparam OptionalT std::optional
+ * @param writer writer to write to
+ * @param optional value to serialize
+ */
+template <class FormatT>
+template <class OptionalT>
+void Serialization::StaticSerializer<FormatT>::serializeOptional(Writer& writer, const OptionalT& optional)
+{
+    format().serializeOptionalStart(writer, optional.has_value());
+    if (optional.has_value()) {
+        serialize(writer, *optional);
+    }
+}
+
+/**
+ * @brief output size of serializeSequence(...)
+ *
+ * @tparam SequenceT std::vector or std::array
+ * @param sequence elements to measure
+ * @return std::size_t
+ */
+template <class FormatT>
+template <class SequenceT>
+std::size_t Serialization::StaticSerializer<FormatT>::sequenceSize(const SequenceT& sequence)
+{
+    std::size_t size = FormatT::arrayStart.size() + FormatT::arrayEnd.size();
+    if constexpr (!TypeTraits::isFixedSequence<SequenceT>) {
+        size += FormatT::arrayLengthSize(sequence.size());
+    }
+    if constexpr (TypeTraits::isBulkSequence<SequenceT>) {
+        size += FormatT::valuesSize(sequence.data(), sequence.size());
+    } else {
+        using ElementT = typename SequenceT::value_type;
+        if (sequence.size() > 0) {
+            size += (sequence.size() - 1) * FormatT::seperator.size();
+        }
+        for (const auto& element : sequence) {
+            size += serializedSize(static_cast<const ElementT&>(element));
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief sums up the sizes of all member values.
+ *
+ * @tparam SerializeableT
+ * @tparam Indices positions of all descriptors
+ * @param object object to measure
+ * @return std::size_t
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t... Indices>
+std::size_t Serialization::StaticSerializer<FormatT>::membersSize(
+    const SerializeableT& object,
+    std::index_sequence<Indices...>)
+{
+    return (std::size_t(0) + ... + memberSize(Descriptor::getDescriptor<SerializeableT, Indices>(), object));
+}
+
+template <class FormatT>
+template <class SerializeableT, class MemberT>
+std::size_t Serialization::StaticSerializer<FormatT>::memberSize(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+    const SerializeableT& object)
+{
+    return serializedSize(descriptor.getMemberValue(object));
+}
+
+template <class FormatT>
+template <class SerializeableT, class ReturnT, class... ArgTs>
+std::size_t Serialization::StaticSerializer<FormatT>::memberSize(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+    const SerializeableT& object)
+{
+    return 0;
+}
+
+/**
+ * @brief writes the precomputed key of a member followed by its value.
+ *
+ * @tparam SerializeableT
+ * @tparam Index position of the descriptor
+ * @tparam MemberT
+ * @param writer
+ * @param descriptor
+ * @param object
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class MemberT>
+void Serialization::StaticSerializer<FormatT>::serializeMember(
+    Writer& writer,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+    const SerializeableT& object)
+{
+    writer.write(keyFragment<SerializeableT, Index>.data(), keyFragment<SerializeableT, Index>.size());
+    serialize(writer, descriptor.getMemberValue(object));
+}
+
+/**
+ * @brief ignore member function descriptors.
+ *
+ * @tparam SerializeableT
+ * @tparam Index
+ * @tparam ReturnT
+ * @tparam ArgTs
+ * @param writer
+ * @param descriptor
+ * @param object
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+void Serialization::StaticSerializer<FormatT>::serializeMember(
+    Writer& writer,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+    const SerializeableT& object)
+{
+    // do nothing
+}
+
+/**
+ * @brief builds the key of a member including the leading seperator.
+ *
+ * @tparam SerializeableT
+ * @tparam Index position of the member descriptor
+ * @return constexpr auto FixedString, e.g. ,"b":
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeKeyFragment()
+{
+    return makeSeperator<Descriptor::isFirstMember<SerializeableT, Index>()>() +
+        FormatT::makeName(Descriptor::getDescriptorName<SerializeableT, Index>());
+}
+
+/**
+ * @brief sums up object start, object end and the key fragments of all members.
+ *
+ * @tparam SerializeableT
+ * @tparam Indices positions of all descriptors
+ * @return constexpr std::size_t
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t... Indices>
+constexpr std::size_t Serialization::StaticSerializer<FormatT>::makeFixedSize(std::index_sequence<Indices...>)
+{
+    return FormatT::objectStart.size() + FormatT::objectEnd.size() +
+        (std::size_t(0) + ... + makeKeySize<SerializeableT, Indices>(Descriptor::getDescriptor<SerializeableT, Indices>()));
+}
+
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class MemberT>
+constexpr std::size_t Serialization::StaticSerializer<FormatT>::makeKeySize(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return keyFragment<SerializeableT, Index>.size();
+}
+
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+constexpr std::size_t Serialization::StaticSerializer<FormatT>::makeKeySize(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return 0;
+}
+
+/**
+ * @brief builds the structure document of a class.
+ *
+ * @tparam SerializeableT type to build the document for
+ * @return constexpr auto FixedString of the complete document
+ */
+template <class FormatT>
+template <class SerializeableT>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeStructure()
+{
+    constexpr std::size_t count = Descriptor::getDescriptorCount<SerializeableT>();
+
+    return FormatT::objectStart +
+        // serialize name
+        FormatT::makeName(FormatT::classNameFieldName) +
+        FormatT::makeString(Descriptor::getClassName<SerializeableT>()) +
+        FormatT::seperator +
+        // serialize members
+        FormatT::makeName(FormatT::membersFieldName) +
+        FormatT::objectStart +
+        makeMemberStructures<SerializeableT>(std::make_index_sequence<count>()) +
+        FormatT::objectEnd +
+        FormatT::seperator +
+        // serialize functions
+        FormatT::makeName(FormatT::functionsFieldName) +
+        FormatT::objectStart +
+        makeFunctionStructures<SerializeableT>(std::make_index_sequence<count>()) +
+        FormatT::objectEnd +
+        FormatT::objectEnd;
+}
+
+/**
+ * @brief seperator in front of an element, empty for the first one
+ *
+ * @tparam first true for the first element of an object
+ * @return constexpr auto FixedString
+ */
+template <class FormatT>
+template <bool first>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeSeperator()
+{
+    if constexpr (first) {
+        return FixedString("");
+    } else {
+        return FormatT::seperator;
+    }
+}
+
+/**
+ * @brief seperator and, for objects, object start in front of a range element
+ *
+ * @tparam SerializeableT type of the elements
+ * @return constexpr auto FixedString
+ */
+template <class FormatT>
+template <class SerializeableT>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeElementPrefix()
+{
+    if constexpr (TypeTraits::isDescribed<SerializeableT>) {
+        return FormatT::seperator + FormatT::objectStart;
+    } else {
+        return FormatT::seperator;
+    }
+}
+
+/**
+ * @brief recurses to describe encapsulated serializeable types.
+ *
+ * @tparam MemberT serializeable type.
+ */
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isDescribed<MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return makeStructure<MemberT>();
+}
+
+/**
+ * @brief std::string has the same type as const char*
+ *
+ * @tparam MemberT std::string
+ */
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isString<MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::typeString;
+}
+
+/**
+ * @brief describes a sequence by its element type
+ *
+ * @tparam MemberT std::vector or std::array
+ */
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isSequence<MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::template makeSequenceStart<TypeTraits::isFixedSequence<MemberT>, TypeTraits::fixedLength<MemberT>>() +
+        makeType<typename MemberT::value_type>() +
+        FormatT::typeSequenceEnd;
+}
+
+/**
+ * @brief describes an optional by its value type
+ *
+ * @tparam MemberT std::optional
+ */
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isOptional<MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::typeOptionalStart + makeType<typename MemberT::value_type>() + FormatT::typeOptionalEnd;
+}
+
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<std::is_same_v<char, MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::typeChar;
+}
+
+/**
+ * @brief type name of a number, chosen by the format from its FixedWidthType
+ *
+ * @tparam MemberT integer or floating point type
+ */
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<Serialization::TypeTraits::isInteger<MemberT> ||
+        Serialization::TypeTraits::isFloatingPoint<MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::template makeNumberType<TypeTraits::FixedWidthType<MemberT>>();
+}
+
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<std::is_same_v<const char*, MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::typeString;
+}
+
+template <class FormatT>
+template <class MemberT,
+    typename std::enable_if_t<std::is_same_v<bool, MemberT>, int>>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeType()
+{
+    return FormatT::typeBool;
+}
+
+/**
+ * @brief concatenates the descriptions of all members
+ *
+ * @tparam SerializeableT
+ * @tparam Indices positions of all descriptors
+ * @return constexpr auto FixedString
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t... Indices>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeMemberStructures(std::index_sequence<Indices...>)
+{
+    return (FixedString("") + ... +
+        makeMemberStructure<SerializeableT, Indices>(Descriptor::getDescriptor<SerializeableT, Indices>()));
+}
+
+/**
+ * @brief describes name and type of a member
+ *
+ * @tparam SerializeableT
+ * @tparam Index position of the descriptor
+ * @tparam MemberT
+ * @param descriptor
+ * @return constexpr auto FixedString
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class MemberT>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeMemberStructure(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return makeSeperator<Descriptor::isFirstMember<SerializeableT, Index>()>() +
+        FormatT::makeName(Descriptor::getDescriptorName<SerializeableT, Index>()) +
+        makeType<std::remove_cv_t<MemberT>>();
+}
+
+/**
+ * @brief overload for ignoring memberFunctionDescriptors
+ *
+ * @return constexpr auto empty FixedString
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeMemberStructure(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return FixedString("");
+}
+
+/**
+ * @brief concatenates the descriptions of all functions
+ *
+ * @tparam SerializeableT
+ * @tparam Indices positions of all descriptors
+ * @return constexpr auto FixedString
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t... Indices>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeFunctionStructures(std::index_sequence<Indices...>)
+{
+    return (FixedString("") + ... +
+        makeFunctionStructure<SerializeableT, Indices>(Descriptor::getDescriptor<SerializeableT, Indices>()));
+}
+
+/**
+ * @brief this overload of the function ignores MemberDescriptors
+ *
+ * @return constexpr auto empty FixedString
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class MemberT>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeFunctionStructure(
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return FixedString("");
+}
+
+/**
+ * @brief describes name and arguments of a function
+ *
+ * @tparam SerializeableT
+ * @tparam Index position of the descriptor
+ * @tparam ReturnT
+ * @tparam ArgTs
+ * @param descriptor
+ * @return constexpr auto FixedString
+ */
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeFunctionStructure(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return makeSeperator<Descriptor::isFirstFunction<SerializeableT, Index>()>() +
+        FormatT::makeName(Descriptor::getDescriptorName<SerializeableT, Index>()) +
+        FormatT::makeName(FormatT::functionArgumentsFieldName) +
+        FormatT::objectStart +
+        makeArguments<SerializeableT, Index, ArgTs...>(std::index_sequence_for<ArgTs...>()) +
+        FormatT::objectEnd;
+}
+
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, class... ArgTs, std::size_t... ArgumentIndices>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeArguments(std::index_sequence<ArgumentIndices...>)
+{
+    return (FixedString("") + ... + makeArgument<SerializeableT, Index, ArgumentIndices, ArgTs>());
+}
+
+template <class FormatT>
+template <class SerializeableT, std::size_t Index, std::size_t ArgumentIndex, class ArgT>
+constexpr auto Serialization::StaticSerializer<FormatT>::makeArgument()
+{
+    return makeSeperator<ArgumentIndex == 0>() +
+        FormatT::makeName(Descriptor::getArgumentName<SerializeableT, Index, ArgumentIndex>()) +
+        makeType<ArgT>();
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,245 @@
+/**
+ * @file StaticSerializer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief generic serializer for C++ classes with compile time format dispatch
+ * @version 1.0
+ * @date 2020-07-27
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __STATICSERIALIZER_H__
+#define __STATICSERIALIZER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+template <class FormatT>
+class StaticSerializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "Descriptor.h"
+#include "FixedString.h"
+#include "Instrumentation.h"
+#include "MemberFunctionDescriptor.h"
+#include "MemberDescriptor.h"
+#include "StreamWriter.h"
+#include "TypeTraits.h"
+#include "Writer.h"
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief generic serializer for C++ classes with compile time format dispatch
+ *
+ * @details Counterpart of Serializer that does not use virtual hooks.
+ * The format is supplied by the deriving class (CRTP), which implements
+ * the same hooks as non virtual functions. All calls are resolved at
+ * compile time, so the fold over the member descriptors can be inlined
+ * into straight line code.
+ * Keys and the structure document only depend on the type, so they are
+ * assembled at compile time and written with a single bulk copy.
+ *
+ * @tparam FormatT deriving class implementing the format hooks
+ */
+template <class FormatT>
+class StaticSerializer
+{
+    // delete default constructors
+    StaticSerializer(const StaticSerializer& other) = delete;
+    StaticSerializer& operator=(const StaticSerializer& other) = delete;
+public:
+    template <class SerializeableT,
+        typename std::enable_if_t<TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    void serialize(Writer& writer, const SerializeableT& object);
+
+    template <class SerializeableT,
+        typename std::enable_if_t<!TypeTraits::isDescribed<SerializeableT>, int>  = 0>
+    void serialize(Writer& writer, const SerializeableT& value);
+
+    template <class SerializeableT>
+    void serialize(std::ostream& os, const SerializeableT& object);
+
+    template <class IteratorT>
+    void serializeRange(Writer& writer, IteratorT first, const IteratorT last);
+
+    template <class RangeT>
+    void serializeRange(Writer& writer, const RangeT& range);
+
+    template <class RangeT>
+    void serializeRange(std::ostream& os, const RangeT& range);
+
+    template <class IteratorT>
+    void serializeRangePart(
+        Writer& writer,
+        IteratorT first,
+        const IteratorT last,
+        const bool isFirstPart,
+        const bool isLastPart);
+
+    template <class SerializeableT>
+    static std::size_t serializedSize(const SerializeableT& value);
+
+    template <class SerializeableT>
+    void serializeStructure(Writer& writer);
+
+    template <class SerializeableT>
+    void serializeStructure(std::ostream& os);
+
+protected:
+    StaticSerializer();
+
+private:
+    FormatT& format();
+
+    template <class SerializeableT, std::size_t... Indices>
+    void serializeMembers(Writer& writer, const SerializeableT& object, std::index_sequence<Indices...>);
+
+    template <class SequenceT>
+    void serializeSequence(Writer& writer, const SequenceT& sequence);
+
+    template <class OptionalT>
+    void serializeOptional(Writer& writer, const OptionalT& optional);
+
+    template <class SerializeableT, std::size_t Index, class MemberT>
+    void serializeMember(
+        Writer& writer,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+        const SerializeableT& object);
+
+    template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+    void serializeMember(
+        Writer& writer,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+        const SerializeableT& object);
+
+    template <class SequenceT>
+    static std::size_t sequenceSize(const SequenceT& sequence);
+
+    template <class SerializeableT, std::size_t... Indices>
+    static std::size_t membersSize(const SerializeableT& object, std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT>
+    static std::size_t memberSize(
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor,
+        const SerializeableT& object);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static std::size_t memberSize(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor,
+        const SerializeableT& object);
+
+    template <class SerializeableT, std::size_t Index>
+    constexpr static auto makeKeyFragment();
+
+    template <class SerializeableT, std::size_t... Indices>
+    constexpr static std::size_t makeFixedSize(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, std::size_t Index, class MemberT>
+    constexpr static std::size_t makeKeySize(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+    constexpr static std::size_t makeKeySize(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT>
+    constexpr static auto makeStructure();
+
+    template <bool first>
+    constexpr static auto makeSeperator();
+
+    template <class SerializeableT>
+    constexpr static auto makeElementPrefix();
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isDescribed<MemberT>, int>  = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isString<MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isSequence<MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isOptional<MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<std::is_same_v<char, MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<TypeTraits::isInteger<MemberT> || TypeTraits::isFloatingPoint<MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<std::is_same_v<const char*, MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class MemberT,
+        typename std::enable_if_t<std::is_same_v<bool, MemberT>, int> = 0>
+    constexpr static auto makeType();
+
+    template <class SerializeableT, std::size_t... Indices>
+    constexpr static auto makeMemberStructures(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, std::size_t Index, class MemberT>
+    constexpr static auto makeMemberStructure(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+    constexpr static auto makeMemberStructure(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT, std::size_t... Indices>
+    constexpr static auto makeFunctionStructures(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, std::size_t Index, class MemberT>
+    constexpr static auto makeFunctionStructure(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, std::size_t Index, class ReturnT, class... ArgTs>
+    constexpr static auto makeFunctionStructure(
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT, std::size_t Index, class... ArgTs, std::size_t... ArgumentIndices>
+    constexpr static auto makeArguments(std::index_sequence<ArgumentIndices...>);
+
+    template <class SerializeableT, std::size_t Index, std::size_t ArgumentIndex, class ArgT>
+    constexpr static auto makeArgument();
+
+    /** key of each member including its leading seperator, e.g. ,"b": */
+    template <class SerializeableT, std::size_t Index>
+    static constexpr auto keyFragment = makeKeyFragment<SerializeableT, Index>();
+
+    /** output size of an object without its values: brackets and all keys */
+    template <class SerializeableT>
+    static constexpr std::size_t fixedSize =
+        makeFixedSize<SerializeableT>(std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+
+    /** written in front of every element of a range but the first, e.g. ,{ */
+    template <class SerializeableT>
+    static constexpr auto elementPrefix = makeElementPrefix<SerializeableT>();
+
+    /** complete output of serializeStructure<SerializeableT>(...) */
+    template <class SerializeableT>
+    static constexpr auto structureDocument = makeStructure<SerializeableT>();
+};
+} // Serialization
+
+// template class, include src
+#include "StaticSerializer.cpp"
+#endif //__STATICSERIALIZER_H__
@@ -0,0 +1,386 @@
+/**
+ * @file StaticSerializerJSON.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief automatic json serializer with compile time format dispatch
+ * @version 1.0
+ * @date 2020-07-27
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __STATICSERIALIZERJSON_H__
+#define __STATICSERIALIZERJSON_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class StaticJSONSerializer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FixedString.h"
+#include "FloatFormatter.h"
+#include "IntegerFormatter.h"
+#include "JSONEscaper.h"
+#include "StaticSerializer.h"
+#include "TypeTraits.h"
+#include "Writer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief automatic json serializer with compile time format dispatch
+ *
+ * @details writes the same output as JSONSerializer.
+ * Names, seperators and type tags are compile time strings,
+ * which StaticSerializer assembles into key fragments and
+ * structure documents.
+ */
+class StaticJSONSerializer : public StaticSerializer<StaticJSONSerializer>
+{
+    friend class StaticSerializer<StaticJSONSerializer>;
+
+    // delete default constructors
+    StaticJSONSerializer(const StaticJSONSerializer& other) = delete;
+    StaticJSONSerializer& operator=(const StaticJSONSerializer& other) = delete;
+public:
+    StaticJSONSerializer(){}
+
+protected:
+    static constexpr auto objectStart = FixedString("{");
+    static constexpr auto objectEnd = FixedString("}");
+    static constexpr auto arrayStart = FixedString("[");
+    static constexpr auto arrayEnd = FixedString("]");
+    static constexpr auto seperator = FixedString(",");
+
+    static constexpr auto classNameFieldName = FixedString("ClassName");
+    static constexpr auto membersFieldName = FixedString("Members");
+    static constexpr auto functionsFieldName = FixedString("Functions");
+    static constexpr auto functionArgumentsFieldName = FixedString("Arguments");
+
+    static constexpr auto typeChar = FixedString("\"CHAR\"");
+    static constexpr auto typeInt = FixedString("\"INT\"");
+    static constexpr auto typeString = FixedString("\"STRING\"");
+    static constexpr auto typeBool = FixedString("\"BOOLEAN\"");
+    static constexpr auto typeInt8 = FixedString("\"INT8\"");
+    static constexpr auto typeUInt8 = FixedString("\"UINT8\"");
+    static constexpr auto typeInt16 = FixedString("\"INT16\"");
+    static constexpr auto typeUInt16 = FixedString("\"UINT16\"");
+    static constexpr auto typeUInt32 = FixedString("\"UINT32\"");
+    static constexpr auto typeInt64 = FixedString("\"INT64\"");
+    static constexpr auto typeUInt64 = FixedString("\"UINT64\"");
+    static constexpr auto typeFloat = FixedString("\"FLOAT\"");
+    static constexpr auto typeDouble = FixedString("\"DOUBLE\"");
+    static constexpr auto typeSequenceEnd = FixedString("]");
+    static constexpr auto typeOptionalStart = FixedString("{\"Optional\":");
+    static constexpr auto typeOptionalEnd = FixedString("}");
+
+    template <bool IsFixed, std::size_t Length>
+    static constexpr auto makeSequenceStart()
+    {
+        return FixedString("[");
+    }
+
+    template <std::size_t Length>
+    static constexpr auto makeName(const FixedString<Length>& name)
+    {
+        return FixedString("\"") + name + FixedString("\":");
+    }
+
+    template <std::size_t Length>
+    static constexpr auto makeString(const FixedString<Length>& value)
+    {
+        return FixedString("\"") + value + FixedString("\"");
+    }
+
+    void serializeObjectStart(Writer& writer)
+    {
+        writer.write('{');
+    }
+
+    void serializeObjectEnd(Writer& writer)
+    {
+        writer.write('}');
+    }
+
+    void serializeArrayStart(Writer& writer)
+    {
+        writer.write('[');
+    }
+
+    void serializeArrayEnd(Writer& writer)
+    {
+        writer.write(']');
+    }
+
+    template <class NumberT,
+        typename std::enable_if_t<TypeTraits::isInteger<NumberT> || TypeTraits::isFloatingPoint<NumberT>, int> = 0>
+    void serializeValue(Writer& writer, const NumberT& value)
+    {
+        writeNumber(writer, value);
+    }
+
+    void serializeValue(Writer& writer, const char& value)
+    {
+        writer.write('"');
+        JSONEscaper::write(writer, value);
+        writer.write('"');
+    }
+
+    void serializeValue(Writer& writer, const bool& value)
+    {
+        if (value) {
+            writer.write("true", 4);
+        } else {
+            writer.write("false", 5);
+        }
+    }
+
+    void serializeValue(Writer& writer, const char* const value)
+    {
+        serializeValue(writer, value, std::strlen(value));
+    }
+
+    void serializeValue(Writer& writer, const char* const value, const std::size_t length)
+    {
+        writer.write('"');
+        JSONEscaper::write(writer, value, length);
+        writer.write('"');
+    }
+
+    template <class ValueT>
+    void serializeValues(Writer& writer, const ValueT* const values, const std::size_t count)
+    {
+        writeValues(writer, values, count);
+    }
+
+    void serializeArrayLength(Writer& writer, const std::size_t length)
+    {
+        // json arrays are terminated instead
+    }
+
+    void serializeOptionalStart(Writer& writer, const bool hasValue)
+    {
+        if (!hasValue) {
+            writer.write("null", 4);
+        }
+    }
+
+    // output sizes of the hooks above, used by serializedSize(...)
+
+    template <class NumberT,
+        typename std::enable_if_t<TypeTraits::isInteger<NumberT> || TypeTraits::isFloatingPoint<NumberT>, int> = 0>
+    static std::size_t valueSize(const NumberT& value)
+    {
+        if constexpr (TypeTraits::isFloatingPoint<NumberT>) {
+            return std::isfinite(value) ? FloatFormatter::length(value) : 4;
+        } else {
+            return IntegerFormatter::length(value);
+        }
+    }
+
+    static std::size_t valueSize(const char& value)
+    {
+        return 2 + JSONEscaper::escapedLength(value);
+    }
+
+    static std::size_t valueSize(const bool& value)
+    {
+        return value ? 4 : 5;
+    }
+
+    static std::size_t valueSize(const char* const value)
+    {
+        return valueSize(value, std::strlen(value));
+    }
+
+    static std::size_t valueSize(const char* const value, const std::size_t length)
+    {
+        return 2 + JSONEscaper::escapedLength(value, length);
+    }
+
+    template <class ValueT>
+    static std::size_t valuesSize(const ValueT* const values, const std::size_t count)
+    {
+        std::size_t size = (count > 0) ? count - 1 : 0;
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            size += valueSize(values[ii]);
+        }
+        return size;
+    }
+
+    static std::size_t arrayLengthSize(const std::size_t length)
+    {
+        return 0;
+    }
+
+    static std::size_t optionalStartSize(const bool hasValue)
+    {
+        return hasValue ? 0 : 4;
+    }
+
+public:
+    /**
+     * @brief writes an integer or a floating point number.
+     *
+     * @details Floating points are written with the fewest digits that
+     * read back to the same value, infinity and NaN as null.
+     * Close to the end of the window the number is formatted on the
+     * stack, so a writer sized by serializedSize(...) does not overflow.
+     * Shared with JSONSerializer.
+     *
+     * @tparam NumberT integer or floating point type
+     * @param writer writer to write to
+     * @param value value to write
+     */
+    template <class NumberT>
+    static void writeNumber(Writer& writer, const NumberT value)
+    {
+        if (writer.getAvailable() < maxNumberLength<NumberT>) {
+            char buffer[maxNumberLength<NumberT>];
+            writer.write(buffer, formatNumber(buffer, value) - buffer);
+            return;
+        }
+        writer.commit(formatNumber(writer.reserve(maxNumberLength<NumberT>), value));
+    }
+
+    /**
+     * @brief writes the elements of an array of numbers, without brackets.
+     *
+     * @details Reserves the worst case for as many elements as fit into
+     * the window and formats them straight into the writer.
+     * Shared with JSONSerializer.
+     *
+     * @tparam NumberT integer or floating point type
+     * @param writer writer to write to
+     * @param values first element
+     * @param count number of elements
+     */
+    template <class NumberT,
+        typename std::enable_if_t<TypeTraits::isInteger<NumberT> || TypeTraits::isFloatingPoint<NumberT>, int> = 0>
+    static void writeValues(Writer& writer, const NumberT* const values, const std::size_t count)
+    {
+        constexpr std::size_t maxElementLength = maxNumberLength<NumberT> + 1;
+
+        std::size_t ii = 0;
+        while (ii < count) {
+            const std::size_t fitting = std::min(count - ii, writer.getAvailable() / maxElementLength);
+            if (fitting == 0) {
+                // window nearly full: grows a BufferWriter, a writer sized by serializedSize(...) just fits
+                if (ii != 0) {
+                    writer.write(',');
+                }
+                writeNumber(writer, values[ii]);
+                ++ii;
+                continue;
+            }
+            char* position = writer.reserve(fitting * maxElementLength);
+            for (const std::size_t last = ii + fitting; ii < last; ++ii) {
+                if (ii != 0) {
+                    *position++ = ',';
+                }
+                position = formatNumber(position, values[ii]);
+            }
+            writer.commit(position);
+        }
+    }
+
+    static void writeValues(Writer& writer, const char* const values, const std::size_t count)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            if (ii != 0) {
+                writer.write(',');
+            }
+            writer.write('"');
+            JSONEscaper::write(writer, values[ii]);
+            writer.write('"');
+        }
+    }
+
+    static void writeValues(Writer& writer, const bool* const values, const std::size_t count)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            if (ii != 0) {
+                writer.write(',');
+            }
+            if (values[ii]) {
+                writer.write("true", 4);
+            } else {
+                writer.write("false", 5);
+            }
+        }
+    }
+
+private:
+    /** maximum number of characters of a number, null fits into all of them */
+    template <class NumberT>
+    static constexpr std::size_t maxNumberLength = TypeTraits::isFloatingPoint<NumberT> ?
+        FloatFormatter::maxLength<NumberT> : IntegerFormatter::maxLength<NumberT>;
+
+    /**
+     * @brief formats a number into memory, json has no infinity and NaN
+     *
+     * @param position memory with at least maxNumberLength<NumberT> bytes
+     * @param value value to write
+     * @return char* one past the last character written
+     */
+    template <class NumberT>
+    static char* formatNumber(char* const position, const NumberT value)
+    {
+        if constexpr (TypeTraits::isFloatingPoint<NumberT>) {
+            if (!std::isfinite(value)) {
+                std::memcpy(position, "null", 4);
+                return position + 4;
+            }
+            return FloatFormatter::format(position, value);
+        } else {
+            return IntegerFormatter::format(position, value);
+        }
+    }
+
+    /**
+     * @brief type name of a number, e.g. "INT64"
+     *
+     * @tparam NumberT FixedWidthType of an integer, float or double
+     * @return constexpr auto FixedString
+     */
+    template <class NumberT>
+    static constexpr auto makeNumberType()
+    {
+        if constexpr (std::is_same_v<std::int32_t, NumberT>) {
+            return typeInt;
+        } else if constexpr (std::is_same_v<std::int8_t, NumberT>) {
+            return typeInt8;
+        } else if constexpr (std::is_same_v<std::uint8_t, NumberT>) {
+            return typeUInt8;
+        } else if constexpr (std::is_same_v<std::int16_t, NumberT>) {
+            return typeInt16;
+        } else if constexpr (std::is_same_v<std::uint16_t, NumberT>) {
+            return typeUInt16;
+        } else if constexpr (std::is_same_v<std::uint32_t, NumberT>) {
+            return typeUInt32;
+        } else if constexpr (std::is_same_v<std::int64_t, NumberT>) {
+            return typeInt64;
+        } else if constexpr (std::is_same_v<std::uint64_t, NumberT>) {
+            return typeUInt64;
+        } else if constexpr (std::is_same_v<float, NumberT>) {
+            return typeFloat;
+        } else {
+            return typeDouble;
+        }
+    }
+};
+} // Serialization
+#endif //__STATICSERIALIZERJSON_H__
@@ -0,0 +1,74 @@
+/**
+ * @file StreamWriter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writer adapter for std::ostream
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "StreamWriter.h"
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a new Stream Writer
+ *
+ * @param os stream to forward the output to
+ */
+inline Serialization::StreamWriter::StreamWriter(std::ostream& os) :
+    Writer(buffer, buffer + bufferSize), os(os)
+{
+}
+
+inline Serialization::StreamWriter::~StreamWriter()
+{
+    flush();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief hands the collected output to the stream
+ */
+inline void Serialization::StreamWriter::flush()
+{
+    if (cursor != begin) {
+        os.write(begin, cursor - begin);
+        passed += cursor - begin;
+        cursor = begin;
+    }
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+inline void Serialization::StreamWriter::writeOverflow(const char* const data, const std::size_t size)
+{
+    flush();
+    if (size < bufferSize) {
+        std::memcpy(cursor, data, size);
+        cursor += size;
+    } else {
+        os.write(data, size);
+        passed += size;
+    }
+}
+
+inline char* Serialization::StreamWriter::reserveOverflow(const std::size_t size)
+{
+    flush();
+    return (size <= bufferSize) ? cursor : nullptr;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
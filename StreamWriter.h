@@ -0,0 +1,68 @@
+/**
+ * @file StreamWriter.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief writer adapter for std::ostream
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __STREAMWRITER_H__
+#define __STREAMWRITER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class StreamWriter;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstddef>
+#include <iostream>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief writer adapter for std::ostream
+ *
+ * @details Collects the output in an internal buffer and hands it to the
+ * stream in blocks, so the stream is only touched once per block instead
+ * of once per token. Flushes on destruction.
+ */
+class StreamWriter : public Writer
+{
+    // delete default constructors
+    StreamWriter(const StreamWriter& other) = delete;
+    StreamWriter& operator=(const StreamWriter& other) = delete;
+public:
+    explicit StreamWriter(std::ostream& os);
+    virtual ~StreamWriter() override;
+
+    void flush();
+
+protected:
+    virtual void writeOverflow(const char* const data, const std::size_t size) override;
+    virtual char* reserveOverflow(const std::size_t size) override;
+
+private:
+    static constexpr std::size_t bufferSize = 1024;
+
+    /** stream to forward to */
+    std::ostream& os;
+    /** collected output */
+    char buffer[bufferSize];
+};
+} // Serialization
+
+// include src
+#include "StreamWriter.cpp"
+#endif //__STREAMWRITER_H__
@@ -0,0 +1,255 @@
+/**
+ * @file TaggedEncoding.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief field keys and wire types of the tagged binary format
+ * @version 1.0
+ * @date 2020-08-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TaggedEncoding.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief wire type of a member of type ValueT
+ *
+ * @tparam ValueT any serializeable type
+ * @return WireType fixed width for primitives, Length for everything else
+ */
+template <class ValueT>
+constexpr Serialization::TaggedEncoding::WireType Serialization::TaggedEncoding::wireType()
+{
+    if constexpr (TypeTraits::isOptional<ValueT>) {
+        // an empty optional is not written, so a present one looks like its value
+        return wireType<typename ValueT::value_type>();
+    } else if constexpr (TypeTraits::isPrimitive<ValueT> && !std::is_same_v<const char*, ValueT>) {
+        switch (BinaryEncoding::fixedSize<ValueT>()) {
+        case 1:
+            return WireType::Fixed1;
+        case 2:
+            return WireType::Fixed2;
+        case 4:
+            return WireType::Fixed4;
+        default:
+            return WireType::Fixed8;
+        }
+    } else {
+        return WireType::Length;
+    }
+}
+
+/**
+ * @brief size of a value of a fixed width wire type
+ *
+ * @param wireType wire type of the value
+ * @return constexpr std::size_t number of bytes, 0 for Length
+ */
+constexpr std::size_t Serialization::TaggedEncoding::fixedSize(const WireType wireType)
+{
+    return (wireType == WireType::Length) ? 0 : (std::size_t(1) << static_cast<std::uint8_t>(wireType));
+}
+
+/**
+ * @brief combines id and wire type of a field
+ *
+ * @param id member id, at most maxId
+ * @param wireType wire type of the value
+ * @return constexpr KeyType key written in front of the value
+ */
+constexpr Serialization::TaggedEncoding::KeyType Serialization::TaggedEncoding::makeKey(
+    const std::uint32_t id,
+    const WireType wireType)
+{
+    return (static_cast<KeyType>(id) << 3) | static_cast<KeyType>(wireType);
+}
+
+/**
+ * @brief number of bytes writeKey(...) writes for a key
+ *
+ * @param key any key
+ * @return constexpr std::size_t 1 to maxKeySize
+ */
+constexpr std::size_t Serialization::TaggedEncoding::keySize(const KeyType key)
+{
+    std::size_t size = 1;
+    for (KeyType left = key >> 7; left != 0; left >>= 7) {
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * @brief writes a key as varint, 7 bits per byte, least significant first.
+ *
+ * @param writer writer to write to
+ * @param key key to write
+ */
+inline void Serialization::TaggedEncoding::writeKey(Writer& writer, KeyType key)
+{
+    char bytes[maxKeySize];
+    std::size_t size = 0;
+    while (key >= 0x80) {
+        bytes[size++] = static_cast<char>((key & 0x7F) | 0x80);
+        key >>= 7;
+    }
+    bytes[size++] = static_cast<char>(key);
+    writer.write(bytes, size);
+}
+
+/**
+ * @brief reads a key written by writeKey(...)
+ *
+ * @param position first byte of the key
+ * @param end end of the input
+ * @param key set to the decoded key
+ * @return std::size_t bytes of the key, 0 if the input ends
+ * or the key is longer than maxKeySize
+ */
+inline std::size_t Serialization::TaggedEncoding::readKey(
+    const char* const position,
+    const char* const end,
+    KeyType& key)
+{
+    // almost every key is a single byte
+    if ((position != end) && (static_cast<unsigned char>(*position) < 0x80)) {
+        key = static_cast<unsigned char>(*position);
+        return 1;
+    }
+    key = 0;
+    for (std::size_t size = 0; (size < maxKeySize) && (position + size != end); ++size) {
+        const unsigned char byte = static_cast<unsigned char>(position[size]);
+        key |= static_cast<KeyType>(byte & 0x7F) << (7 * size);
+        if (byte < 0x80) {
+            return size + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief number of member variables of a class, functions are no fields
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @return constexpr std::size_t number of fields
+ */
+template <class SerializeableT>
+constexpr std::size_t Serialization::TaggedEncoding::fieldCount()
+{
+    return countFields<SerializeableT>(std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+}
+
+/**
+ * @brief ids and descriptor positions of all member variables, sorted by id.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @return constexpr auto std::array of fieldCount() Fields in ascending id order
+ */
+template <class SerializeableT>
+constexpr auto Serialization::TaggedEncoding::makeFieldTable()
+{
+    std::array<Field, fieldCount<SerializeableT>()> table{};
+    addFields<SerializeableT>(table, std::make_index_sequence<Descriptor::getDescriptorCount<SerializeableT>()>());
+    // insertion sort, members are usually described in id order already
+    for (std::size_t ii = 1; ii < table.size(); ++ii) {
+        const Field field = table[ii];
+        std::size_t position = ii;
+        for (; (position > 0) && (table[position - 1].id > field.id); --position) {
+            table[position] = table[position - 1];
+        }
+        table[position] = field;
+    }
+    return table;
+}
+
+/**
+ * @brief checks that every member variable has an id that is unique and fits into a key.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @return true if the class can be written in the tagged format
+ */
+template <class SerializeableT>
+constexpr bool Serialization::TaggedEncoding::hasValidIds()
+{
+    constexpr auto table = makeFieldTable<SerializeableT>();
+    for (std::size_t ii = 0; ii < table.size(); ++ii) {
+        // 0 is the noId of members described without an id
+        if ((table[ii].id == 0) || (table[ii].id > maxId) ||
+            ((ii > 0) && (table[ii - 1].id == table[ii].id))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+template <class SerializeableT, std::size_t... Indices>
+constexpr std::size_t Serialization::TaggedEncoding::countFields(std::index_sequence<Indices...>)
+{
+    return (std::size_t(0) + ... + (isField(Descriptor::getDescriptor<SerializeableT, Indices>()) ? 1 : 0));
+}
+
+template <class SerializeableT, std::size_t Count, std::size_t... Indices>
+constexpr void Serialization::TaggedEncoding::addFields(std::array<Field, Count>& table, std::index_sequence<Indices...>)
+{
+    std::size_t size = 0;
+    (addField(table, size, Indices, Descriptor::getDescriptor<SerializeableT, Indices>()), ...);
+}
+
+/**
+ * @brief appends a member variable to the table
+ *
+ * @param table table to fill
+ * @param size number of fields in the table, updated
+ * @param index position of the descriptor
+ * @param descriptor descriptor of the member
+ */
+template <class SerializeableT, class MemberT, std::size_t Count>
+constexpr void Serialization::TaggedEncoding::addField(
+    std::array<Field, Count>& table,
+    std::size_t& size,
+    const std::size_t index,
+    const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    table[size++] = Field{descriptor.getId(), index};
+}
+
+/**
+ * @brief functions are not written
+ */
+template <class SerializeableT, class ReturnT, class... ArgTs, std::size_t Count>
+constexpr void Serialization::TaggedEncoding::addField(
+    std::array<Field, Count>& table,
+    std::size_t& size,
+    const std::size_t index,
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+}
+
+template <class SerializeableT, class MemberT>
+constexpr bool Serialization::TaggedEncoding::isField(const MemberDescriptor<SerializeableT, MemberT>& descriptor)
+{
+    return true;
+}
+
+template <class SerializeableT, class ReturnT, class... ArgTs>
+constexpr bool Serialization::TaggedEncoding::isField(
+    const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor)
+{
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
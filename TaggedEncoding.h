@@ -0,0 +1,145 @@
+/**
+ * @file TaggedEncoding.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief field keys and wire types of the tagged binary format
+ * @version 1.0
+ * @date 2020-08-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TAGGEDENCODING_H__
+#define __TAGGEDENCODING_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class TaggedEncoding;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BinaryEncoding.h"
+#include "Descriptor.h"
+#include "MemberDescriptor.h"
+#include "MemberFunctionDescriptor.h"
+#include "TypeTraits.h"
+#include "Writer.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief field keys and wire types of the tagged binary format
+ *
+ * @details Shared by TaggedSerializer and TaggedDeserializer. An object
+ * is a sequence of fields, each a key followed by the value:
+ *
+ *     key      varint of (member id << 3 | wire type), 1 byte for ids below 16
+ *     Fixed1   char, bool, 8 bit integers
+ *     Fixed2   16 bit integers
+ *     Fixed4   int, 32 bit integers, float
+ *     Fixed8   64 bit integers, double
+ *     Length   uint32 length and the content: characters of strings,
+ *              elements of std::vector and std::array, fields of classes
+ *
+ * Values are encoded like BinaryEncoding. Elements of sequences have no
+ * key, elements of the Length type have their length, std::optional
+ * elements a presence byte. An empty std::optional member is not written.
+ * The wire type alone tells the size of a field, so a reader skips
+ * fields it does not know without decoding them.
+ */
+class TaggedEncoding
+{
+    // delete default constructors
+    TaggedEncoding() = delete;
+    TaggedEncoding(const TaggedEncoding& other) = delete;
+    TaggedEncoding& operator=(const TaggedEncoding& other) = delete;
+public:
+    /** how the size of a value is known */
+    enum class WireType : std::uint8_t
+    {
+        Fixed1 = 0,
+        Fixed2 = 1,
+        Fixed4 = 2,
+        Fixed8 = 3,
+        Length = 4
+    };
+
+    /** id and wire type of a field */
+    using KeyType = std::uint32_t;
+
+    /** member ids have to fit into a key together with the wire type */
+    static constexpr std::uint32_t maxId = (KeyType(1) << 29) - 1;
+    /** bytes of the longest key */
+    static constexpr std::size_t maxKeySize = 5;
+
+    /** member of a class identified by its id */
+    struct Field
+    {
+        /** id of the member */
+        std::uint32_t id;
+        /** position in makeClassDescriptor(...) */
+        std::size_t index;
+    };
+
+    template <class ValueT>
+    static constexpr WireType wireType();
+
+    static constexpr std::size_t fixedSize(const WireType wireType);
+
+    static constexpr KeyType makeKey(const std::uint32_t id, const WireType wireType);
+    static constexpr std::size_t keySize(const KeyType key);
+    static void writeKey(Writer& writer, KeyType key);
+    static std::size_t readKey(const char* const position, const char* const end, KeyType& key);
+
+    template <class SerializeableT>
+    static constexpr std::size_t fieldCount();
+
+    template <class SerializeableT>
+    static constexpr auto makeFieldTable();
+
+    template <class SerializeableT>
+    static constexpr bool hasValidIds();
+
+private:
+    template <class SerializeableT, std::size_t... Indices>
+    static constexpr std::size_t countFields(std::index_sequence<Indices...>);
+
+    template <class SerializeableT, std::size_t Count, std::size_t... Indices>
+    static constexpr void addFields(std::array<Field, Count>& table, std::index_sequence<Indices...>);
+
+    template <class SerializeableT, class MemberT, std::size_t Count>
+    static constexpr void addField(
+        std::array<Field, Count>& table,
+        std::size_t& size,
+        const std::size_t index,
+        const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs, std::size_t Count>
+    static constexpr void addField(
+        std::array<Field, Count>& table,
+        std::size_t& size,
+        const std::size_t index,
+        const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+
+    template <class SerializeableT, class MemberT>
+    static constexpr bool isField(const MemberDescriptor<SerializeableT, MemberT>& descriptor);
+
+    template <class SerializeableT, class ReturnT, class... ArgTs>
+    static constexpr bool isField(const MemberFunctionDescriptor<SerializeableT, ReturnT, ArgTs...>& descriptor);
+};
+} // Serialization
+
+// template functions, include src
+#include "TaggedEncoding.cpp"
+#endif //__TAGGEDENCODING_H__
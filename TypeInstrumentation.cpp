@@ -0,0 +1,341 @@
+/**
+ * @file TypeInstrumentation.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief records calls, bytes and latencies of serialization per type
+ * @version 1.0
+ * @date 2020-09-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TypeInstrumentation.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief starts measuring a call
+ *
+ * @param operation measured operation
+ * @param position position in the output or input at the start
+ */
+template <class SerializeableT>
+Serialization::TypeInstrumentation::Scope<SerializeableT>::Scope(
+    const InstrumentedOperation operation,
+    const std::size_t position) :
+    operation(operation), position(position), isOutermost(getThreadCounters().depth++ == 0),
+    begin(isOutermost ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+{
+}
+
+template <class SerializeableT>
+Serialization::TypeInstrumentation::Scope<SerializeableT>::~Scope()
+{
+    --getThreadCounters().depth;
+}
+
+inline Serialization::TypeInstrumentation::CounterTable::CounterTable() :
+    types()
+{
+    for (std::atomic<TypeCounters*>& type : types) {
+        type.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+inline Serialization::TypeInstrumentation::CounterTable::~CounterTable()
+{
+    for (std::atomic<TypeCounters*>& type : types) {
+        delete type.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief registers the counters of the calling thread
+ */
+inline Serialization::TypeInstrumentation::ThreadCounters::ThreadCounters() :
+    table(), depth(0)
+{
+    Registry& registry = getRegistry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threads.push_back(this);
+}
+
+/**
+ * @brief keeps the counts of the ending thread in the retired counters
+ */
+inline Serialization::TypeInstrumentation::ThreadCounters::~ThreadCounters()
+{
+    Registry& registry = getRegistry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.retired.add(table);
+    registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief records the call, if it is not nested into another one
+ *
+ * @param position position in the output or input at the end
+ * @param calls number of calls the scope stands for, e.g. objects copied at once
+ */
+template <class SerializeableT>
+void Serialization::TypeInstrumentation::Scope<SerializeableT>::finish(
+    const std::size_t position,
+    const std::size_t calls)
+{
+    if (isOutermost) {
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        record(
+            getSlot<SerializeableT>(),
+            operation,
+            calls,
+            position - this->position,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+}
+
+/**
+ * @brief merges the counters of all threads, running and ended.
+ *
+ * @details Counts of running threads are read while they keep counting,
+ * so a call may be seen partly.
+ *
+ * @return std::vector<Statistics> counts of every type and operation that was called
+ */
+inline std::vector<Serialization::TypeInstrumentation::Statistics> Serialization::TypeInstrumentation::collect()
+{
+    Registry& registry = getRegistry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<Statistics> statistics;
+    for (std::size_t slot = 0; slot < registry.typeCount; ++slot) {
+        for (std::size_t operation = 0; operation < operationCount; ++operation) {
+            Statistics merged{registry.names[slot], getOperationName(operation), 0, 0, 0, {}};
+            const auto merge = [&](const CounterTable& table) {
+                if (const TypeCounters* const counters = table.find(slot)) {
+                    const Counters& source = (*counters)[operation];
+                    merged.calls += source.calls.load(std::memory_order_relaxed);
+                    merged.bytes += source.bytes.load(std::memory_order_relaxed);
+                    merged.nanoseconds += source.nanoseconds.load(std::memory_order_relaxed);
+                    for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                        merged.histogram[bucket] += source.histogram[bucket].load(std::memory_order_relaxed);
+                    }
+                }
+            };
+
+            merge(registry.retired);
+            for (const ThreadCounters* const thread : registry.threads) {
+                merge(thread->table);
+            }
+            if (merged.calls != 0) {
+                statistics.push_back(merged);
+            }
+        }
+    }
+    return statistics;
+}
+
+/**
+ * @brief sets all counts to zero, calls running meanwhile may be lost
+ */
+inline void Serialization::TypeInstrumentation::reset()
+{
+    Registry& registry = getRegistry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.retired.clear();
+    for (ThreadCounters* const thread : registry.threads) {
+        thread->table.clear();
+    }
+}
+
+/**
+ * @brief gets the counters of a slot, allocates them on first use.
+ *
+ * @details Only called by the thread owning the table.
+ *
+ * @param slot slot of the type
+ * @return TypeCounters& counters of the slot
+ */
+inline Serialization::TypeInstrumentation::TypeCounters& Serialization::TypeInstrumentation::CounterTable::get(
+    const std::size_t slot)
+{
+    TypeCounters* counters = types[slot].load(std::memory_order_relaxed);
+    if (counters == nullptr) {
+        counters = new TypeCounters();
+        types[slot].store(counters, std::memory_order_release);
+    }
+    return *counters;
+}
+
+/**
+ * @brief gets the counters of a slot without allocating them
+ *
+ * @param slot slot of the type
+ * @return const TypeCounters* counters of the slot, nullptr if never recorded
+ */
+inline const Serialization::TypeInstrumentation::TypeCounters* Serialization::TypeInstrumentation::CounterTable::find(
+    const std::size_t slot) const
+{
+    return types[slot].load(std::memory_order_acquire);
+}
+
+/**
+ * @brief adds the counts of another table to this one
+ *
+ * @param other table to add
+ */
+inline void Serialization::TypeInstrumentation::CounterTable::add(const CounterTable& other)
+{
+    for (std::size_t slot = 0; slot < maxTypes; ++slot) {
+        const TypeCounters* const source = other.find(slot);
+        if (source == nullptr) {
+            continue;
+        }
+        TypeCounters& target = get(slot);
+        for (std::size_t operation = 0; operation < operationCount; ++operation) {
+            TypeInstrumentation::add(target[operation].calls, (*source)[operation].calls.load(std::memory_order_relaxed));
+            TypeInstrumentation::add(target[operation].bytes, (*source)[operation].bytes.load(std::memory_order_relaxed));
+            TypeInstrumentation::add(target[operation].nanoseconds,
+                (*source)[operation].nanoseconds.load(std::memory_order_relaxed));
+            for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                TypeInstrumentation::add(target[operation].histogram[bucket],
+                    (*source)[operation].histogram[bucket].load(std::memory_order_relaxed));
+            }
+        }
+    }
+}
+
+/**
+ * @brief sets the counts of all slots to zero
+ */
+inline void Serialization::TypeInstrumentation::CounterTable::clear()
+{
+    for (std::atomic<TypeCounters*>& type : types) {
+        if (TypeCounters* const counters = type.load(std::memory_order_acquire)) {
+            for (Counters& operation : *counters) {
+                operation.calls.store(0, std::memory_order_relaxed);
+                operation.bytes.store(0, std::memory_order_relaxed);
+                operation.nanoseconds.store(0, std::memory_order_relaxed);
+                for (std::atomic<std::uint64_t>& bucket : operation.histogram) {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief gets the slot of a class, registered on the first call
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @return std::size_t slot, maxTypes if the table is full
+ */
+template <class SerializeableT>
+std::size_t Serialization::TypeInstrumentation::getSlot()
+{
+    static const std::size_t slot = registerType(typeName<SerializeableT>.data());
+    return slot;
+}
+
+/**
+ * @brief finds or adds the slot of a class name
+ *
+ * @param name name of the class descriptor
+ * @return std::size_t slot, maxTypes if the table is full
+ */
+inline std::size_t Serialization::TypeInstrumentation::registerType(const char* const name)
+{
+    Registry& registry = getRegistry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    for (std::size_t slot = 0; slot < registry.typeCount; ++slot) {
+        if (std::strcmp(registry.names[slot], name) == 0) {
+            return slot;
+        }
+    }
+    if (registry.typeCount == maxTypes) {
+        return maxTypes;
+    }
+    registry.names[registry.typeCount] = name;
+    return registry.typeCount++;
+}
+
+inline Serialization::TypeInstrumentation::Registry& Serialization::TypeInstrumentation::getRegistry()
+{
+    static Registry registry{};
+    return registry;
+}
+
+inline Serialization::TypeInstrumentation::ThreadCounters& Serialization::TypeInstrumentation::getThreadCounters()
+{
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+/**
+ * @brief counts calls in the table of the calling thread
+ *
+ * @details Several calls measured together all count in the bucket of
+ * their average latency.
+ *
+ * @param slot slot of the type
+ * @param operation measured operation
+ * @param calls number of calls
+ * @param bytes bytes written or read by all calls
+ * @param nanoseconds duration of all calls
+ */
+inline void Serialization::TypeInstrumentation::record(
+    const std::size_t slot,
+    const InstrumentedOperation operation,
+    const std::uint64_t calls,
+    const std::uint64_t bytes,
+    const std::uint64_t nanoseconds)
+{
+    if (slot == maxTypes || calls == 0) {
+        return;
+    }
+    Counters& counters = getThreadCounters().table.get(slot)[static_cast<std::size_t>(operation)];
+    add(counters.calls, calls);
+    add(counters.bytes, bytes);
+    add(counters.nanoseconds, nanoseconds);
+    add(counters.histogram[std::min<std::size_t>(std::bit_width(nanoseconds / calls), bucketCount - 1)], calls);
+}
+
+/**
+ * @brief adds to a counter that only the calling thread writes, without a locked instruction
+ *
+ * @param counter counter to increase
+ * @param value value to add
+ */
+inline void Serialization::TypeInstrumentation::add(std::atomic<std::uint64_t>& counter, const std::uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+inline const char* Serialization::TypeInstrumentation::getOperationName(const std::size_t operation)
+{
+    switch (static_cast<InstrumentedOperation>(operation)) {
+    case InstrumentedOperation::Serialize:
+        return "serialize";
+    case InstrumentedOperation::SerializeStructure:
+        return "serializeStructure";
+    case InstrumentedOperation::Deserialize:
+        return "deserialize";
+    }
+    return "unknown";
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,227 @@
+/**
+ * @file TypeInstrumentation.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief records calls, bytes and latencies of serialization per type
+ * @version 1.0
+ * @date 2020-09-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TYPEINSTRUMENTATION_H__
+#define __TYPEINSTRUMENTATION_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class TypeInstrumentation;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Descriptor.h"
+#include "Instrumentation.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief records calls, bytes and latencies of serialization per type
+ *
+ * @details Selected by defining SERIALIZATION_INSTRUMENTATION. Every
+ * outermost call of an instrumented operation counts for the described
+ * class it was made with, nested classes are part of the call of their
+ * parent. Each element of a range counts as one call, objects copied as
+ * a whole count one call each. Each thread counts into its own table
+ * without locking, only the first call of a type on a thread allocates
+ * its counters. collect() merges the tables of all threads, including
+ * those that ended, by the name of the class descriptor. Latencies are
+ * kept in a histogram with power of two buckets. Types beyond maxTypes
+ * are not recorded.
+ */
+class TypeInstrumentation
+{
+    // delete default constructors
+    TypeInstrumentation() = delete;
+    TypeInstrumentation(const TypeInstrumentation& other) = delete;
+    TypeInstrumentation& operator=(const TypeInstrumentation& other) = delete;
+public:
+    /** whether anything is recorded */
+    static constexpr bool isEnabled = true;
+    /** number of distinct class names that can be recorded */
+    static constexpr std::size_t maxTypes = 256;
+    /** buckets of the latency histogram, bucket i counts calls of [2^(i-1), 2^i) ns */
+    static constexpr std::size_t bucketCount = 32;
+
+    /**
+     * @brief merged counts of a type and operation
+     */
+    struct Statistics
+    {
+        /** name of the class descriptor */
+        const char* type;
+        /** serialize, serializeStructure or deserialize */
+        const char* operation;
+        /** number of calls */
+        std::uint64_t calls;
+        /** bytes written or read by all calls */
+        std::uint64_t bytes;
+        /** time of all calls */
+        std::uint64_t nanoseconds;
+        /** calls per latency bucket, the last one takes all slower calls */
+        std::array<std::uint64_t, bucketCount> histogram;
+
+        static constexpr auto descriptor = Descriptor::makeClassDescriptor(
+            "Statistics",
+            &Statistics::type, "type",
+            &Statistics::operation, "operation",
+            &Statistics::calls, "calls",
+            &Statistics::bytes, "bytes",
+            &Statistics::nanoseconds, "nanoseconds",
+            &Statistics::histogram, "histogram"
+        );
+    };
+
+    /**
+     * @brief measures a call from construction to finish(...)
+     *
+     * @tparam SerializeableT any class with static descriptor
+     */
+    template <class SerializeableT>
+    class Scope
+    {
+        // delete default constructors
+        Scope(const Scope& other) = delete;
+        Scope& operator=(const Scope& other) = delete;
+    public:
+        Scope(const InstrumentedOperation operation, const std::size_t position);
+        ~Scope();
+
+        void finish(const std::size_t position, const std::size_t calls = 1);
+
+    private:
+        /** measured operation */
+        const InstrumentedOperation operation;
+        /** position in the output or input at the start */
+        const std::size_t position;
+        /** only calls that are not nested into another one are recorded */
+        const bool isOutermost;
+        /** start of the call */
+        const std::chrono::steady_clock::time_point begin;
+    };
+
+    static std::vector<Statistics> collect();
+    static void reset();
+
+private:
+    /** number of InstrumentedOperations */
+    static constexpr std::size_t operationCount = 3;
+
+    /** counts of a type and operation, written by one thread only */
+    struct Counters
+    {
+        std::atomic<std::uint64_t> calls;
+        std::atomic<std::uint64_t> bytes;
+        std::atomic<std::uint64_t> nanoseconds;
+        std::array<std::atomic<std::uint64_t>, bucketCount> histogram;
+    };
+
+    /** counters of each operation of a type */
+    using TypeCounters = std::array<Counters, operationCount>;
+
+    /**
+     * @brief counters of each type, allocated on first use
+     */
+    class CounterTable
+    {
+        // delete default constructors
+        CounterTable(const CounterTable& other) = delete;
+        CounterTable& operator=(const CounterTable& other) = delete;
+    public:
+        CounterTable();
+        ~CounterTable();
+
+        TypeCounters& get(const std::size_t slot);
+        const TypeCounters* find(const std::size_t slot) const;
+
+        void add(const CounterTable& other);
+        void clear();
+
+    private:
+        /** counters of each slot, nullptr until the type is recorded */
+        std::array<std::atomic<TypeCounters*>, maxTypes> types;
+    };
+
+    /**
+     * @brief counters of a thread, merged into the retired ones when it ends
+     */
+    class ThreadCounters
+    {
+        // delete default constructors
+        ThreadCounters(const ThreadCounters& other) = delete;
+        ThreadCounters& operator=(const ThreadCounters& other) = delete;
+    public:
+        ThreadCounters();
+        ~ThreadCounters();
+
+        /** counters of this thread */
+        CounterTable table;
+        /** instrumented calls currently running on this thread */
+        std::size_t depth;
+    };
+
+    /**
+     * @brief state shared by all threads
+     */
+    struct Registry
+    {
+        /** guards everything but the counters themselves */
+        std::mutex mutex;
+        /** counters of the running threads */
+        std::vector<ThreadCounters*> threads;
+        /** counts of the threads that ended */
+        CounterTable retired;
+        /** class name of each slot */
+        std::array<const char*, maxTypes> names;
+        /** slots in use */
+        std::size_t typeCount;
+    };
+
+    /** name of a class descriptor with static storage */
+    template <class SerializeableT>
+    static constexpr auto typeName = Descriptor::getClassName<SerializeableT>();
+
+    template <class SerializeableT>
+    static std::size_t getSlot();
+
+    static std::size_t registerType(const char* const name);
+    static Registry& getRegistry();
+    static ThreadCounters& getThreadCounters();
+
+    static void record(
+        const std::size_t slot,
+        const InstrumentedOperation operation,
+        const std::uint64_t calls,
+        const std::uint64_t bytes,
+        const std::uint64_t nanoseconds);
+
+    static void add(std::atomic<std::uint64_t>& counter, const std::uint64_t value);
+    static const char* getOperationName(const std::size_t operation);
+};
+} // Serialization
+
+// template functions, include src
+#include "TypeInstrumentation.cpp"
+#endif //__TYPEINSTRUMENTATION_H__
@@ -0,0 +1,200 @@
+/**
+ * @file TypeTraits.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief categories of serializeable types
+ * @version 1.0
+ * @date 2020-08-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TYPETRAITS_H__
+#define __TYPETRAITS_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class TypeTraits;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief categories of serializeable types
+ *
+ * @details Every serializeable type falls into exactly one category:
+ * primitives (values the formats write themselves), strings and string views,
+ * sequences (std::vector and std::array), optionals and described
+ * classes with a static descriptor. Serializers and deserializers
+ * dispatch on these instead of listing the types themselves.
+ */
+class TypeTraits
+{
+    // delete default constructors
+    TypeTraits() = delete;
+    TypeTraits(const TypeTraits& other) = delete;
+    TypeTraits& operator=(const TypeTraits& other) = delete;
+
+    // detection helpers, declared first as the constants below use them
+    template <class T>
+    struct StringDetector : std::false_type {};
+
+    template <class CharTraitsT, class AllocatorT>
+    struct StringDetector<std::basic_string<char, CharTraitsT, AllocatorT>> : std::true_type {};
+
+    template <class CharTraitsT>
+    struct StringDetector<std::basic_string_view<char, CharTraitsT>> : std::true_type {};
+
+    template <class T>
+    struct StringViewDetector : std::false_type {};
+
+    template <class CharTraitsT>
+    struct StringViewDetector<std::basic_string_view<char, CharTraitsT>> : std::true_type {};
+
+    template <class T>
+    struct SequenceDetector : std::false_type
+    {
+        using ElementType = void;
+        static constexpr bool isFixed = false;
+        static constexpr std::size_t length = 0;
+    };
+
+    template <class ElementT, class AllocatorT>
+    struct SequenceDetector<std::vector<ElementT, AllocatorT>> : std::true_type
+    {
+        using ElementType = ElementT;
+        static constexpr bool isFixed = false;
+        static constexpr std::size_t length = 0;
+    };
+
+    template <class ElementT, std::size_t Length>
+    struct SequenceDetector<std::array<ElementT, Length>> : std::true_type
+    {
+        using ElementType = ElementT;
+        static constexpr bool isFixed = true;
+        static constexpr std::size_t length = Length;
+    };
+
+    template <class T, class = void>
+    struct MemoryResourceDetector : std::false_type {};
+
+    template <class T>
+    struct MemoryResourceDetector<T, std::void_t<typename T::allocator_type, typename T::value_type>> :
+        std::is_same<typename T::allocator_type, std::pmr::polymorphic_allocator<typename T::value_type>> {};
+
+    template <class T>
+    struct OptionalDetector : std::false_type {};
+
+    template <class ValueT>
+    struct OptionalDetector<std::optional<ValueT>> : std::true_type {};
+
+    template <class T, bool IsInteger>
+    struct FixedWidth
+    {
+        using Type = T;
+    };
+
+    template <class T>
+    struct FixedWidth<T, true>
+    {
+        template <class SignedT, class UnsignedT>
+        using Signed = std::conditional_t<std::is_signed_v<T>, SignedT, UnsignedT>;
+
+        using Type =
+            std::conditional_t<sizeof(T) == 1, Signed<std::int8_t, std::uint8_t>,
+            std::conditional_t<sizeof(T) == 2, Signed<std::int16_t, std::uint16_t>,
+            std::conditional_t<sizeof(T) == 4, Signed<std::int32_t, std::uint32_t>,
+            Signed<std::int64_t, std::uint64_t>>>>;
+    };
+
+public:
+    /** integral types written as numbers, char is a character and bool a boolean */
+    template <class T>
+    static constexpr bool isInteger =
+        std::is_integral_v<T> && !std::is_same_v<char, T> && !std::is_same_v<bool, T>;
+
+    /** floating point types, long double has no portable encoding */
+    template <class T>
+    static constexpr bool isFloatingPoint = std::is_same_v<float, T> || std::is_same_v<double, T>;
+
+    /** types written by the value hooks of the formats */
+    template <class T>
+    static constexpr bool isPrimitive =
+        std::is_same_v<char, T> ||
+        std::is_same_v<const char*, T> ||
+        std::is_same_v<bool, T> ||
+        isInteger<T> ||
+        isFloatingPoint<T>;
+
+    /**
+     * std::intN_t or std::uintN_t of the same size and signedness for integers,
+     * the type itself otherwise. The value hooks take these, so e.g. long long
+     * and long are written by the same hook.
+     */
+    template <class T>
+    using FixedWidthType = typename FixedWidth<T, isInteger<T>>::Type;
+
+    /** std::string with any traits and allocator or std::string_view */
+    template <class T>
+    static constexpr bool isString = StringDetector<T>::value;
+
+    /** std::string_view, only deserialized in situ as it points into the input */
+    template <class T>
+    static constexpr bool isStringView = StringViewDetector<T>::value;
+
+    /** std::vector or std::array of any serializeable type */
+    template <class T>
+    static constexpr bool isSequence = SequenceDetector<T>::value;
+
+    /** sequence with a length fixed by its type, i.e. std::array */
+    template <class T>
+    static constexpr bool isFixedSequence = SequenceDetector<T>::isFixed;
+
+    /** length of a fixed sequence */
+    template <class T>
+    static constexpr std::size_t fixedLength = SequenceDetector<T>::length;
+
+    /** std::pmr::string or std::pmr::vector, allocating from a std::pmr::memory_resource */
+    template <class T>
+    static constexpr bool usesMemoryResource = MemoryResourceDetector<T>::value;
+
+    /** std::optional of any serializeable type */
+    template <class T>
+    static constexpr bool isOptional = OptionalDetector<T>::value;
+
+    /** class with a static descriptor, serialized member by member */
+    template <class T>
+    static constexpr bool isDescribed =
+        std::is_class_v<T> && !isString<T> && !isSequence<T> && !isOptional<T>;
+
+    /**
+     * contiguous sequence of numbers, chars or bools, written with a single
+     * format hook instead of one per element. std::vector<bool> is not contiguous,
+     * integers like long long are only taken if they are their FixedWidthType.
+     */
+    template <class T>
+    static constexpr bool isBulkSequence = isPrimitive<typename SequenceDetector<T>::ElementType> &&
+        std::is_same_v<typename SequenceDetector<T>::ElementType, FixedWidthType<typename SequenceDetector<T>::ElementType>> &&
+        !std::is_same_v<const char*, typename SequenceDetector<T>::ElementType> &&
+        (isFixedSequence<T> || !std::is_same_v<bool, typename SequenceDetector<T>::ElementType>);
+};
+} // Serialization
+#endif //__TYPETRAITS_H__
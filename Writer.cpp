@@ -0,0 +1,111 @@
+/**
+ * @file Writer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief output sink for serializers
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Writer.h"
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Serialization::Writer::Writer(char* const begin, char* const end) :
+    begin(begin), cursor(begin), end(end), passed(0)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief writes a block of data.
+ *
+ * @param data data to write
+ * @param size number of bytes to write
+ */
+inline void Serialization::Writer::write(const char* const data, const std::size_t size)
+{
+    if (size <= static_cast<std::size_t>(end - cursor)) {
+        std::memcpy(cursor, data, size);
+        cursor += size;
+    } else {
+        writeOverflow(data, size);
+    }
+}
+
+/**
+ * @brief writes a single character.
+ *
+ * @param character character to write
+ */
+inline void Serialization::Writer::write(const char character)
+{
+    if (cursor != end) {
+        *cursor++ = character;
+    } else {
+        writeOverflow(&character, 1);
+    }
+}
+
+/**
+ * @brief gets a position that at least size bytes can be written to.
+ *
+ * @details Used to format values directly into the output.
+ * Finish with commit(...), nothing else may be written in between.
+ *
+ * @param size maximum number of bytes that will be written
+ * @return char* position to write to, nullptr if the writer is full
+ */
+inline char* Serialization::Writer::reserve(const std::size_t size)
+{
+    if (size <= static_cast<std::size_t>(end - cursor)) {
+        return cursor;
+    }
+    return reserveOverflow(size);
+}
+
+/**
+ * @brief finishes a write started with reserve(...).
+ *
+ * @param position one past the last byte written
+ */
+inline void Serialization::Writer::commit(char* const position)
+{
+    cursor = position;
+}
+
+/**
+ * @brief number of bytes that fit into the window without an overflow.
+ *
+ * @return std::size_t free bytes behind the cursor
+ */
+inline std::size_t Serialization::Writer::getAvailable() const
+{
+    return end - cursor;
+}
+
+/**
+ * @brief number of bytes written so far, including those that left the window.
+ *
+ * @return std::size_t position of the cursor in the whole output
+ */
+inline std::size_t Serialization::Writer::getPosition() const
+{
+    return passed + (cursor - begin);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
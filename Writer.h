@@ -0,0 +1,89 @@
+/**
+ * @file Writer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief output sink for serializers
+ * @version 1.0
+ * @date 2020-07-29
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __WRITER_H__
+#define __WRITER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Serialization
+{
+class Writer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+
+namespace Serialization
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief output sink for serializers
+ *
+ * @details A writer is a contiguous window [cursor, end) of memory.
+ * As long as the window is large enough, writing only copies into it and
+ * bumps the cursor. Only when it runs full the deriving class is asked
+ * through a virtual function to grow, flush or report the overflow.
+ */
+class Writer
+{
+    // delete default constructors
+    Writer() = delete;
+    Writer(const Writer& other) = delete;
+    Writer& operator=(const Writer& other) = delete;
+public:
+    void write(const char* const data, const std::size_t size);
+    void write(const char character);
+
+    char* reserve(const std::size_t size);
+    void commit(char* const position);
+
+    std::size_t getAvailable() const;
+    std::size_t getPosition() const;
+
+protected:
+    Writer(char* const begin, char* const end);
+    virtual ~Writer() = default;
+
+    /**
+     * @brief called by write(...) if data does not fit into the window
+     *
+     * @param data data to write
+     * @param size number of bytes to write
+     */
+    virtual void writeOverflow(const char* const data, const std::size_t size) = 0;
+
+    /**
+     * @brief called by reserve(...) if size does not fit into the window
+     *
+     * @param size number of bytes needed
+     * @return char* position to write to, nullptr if not possible
+     */
+    virtual char* reserveOverflow(const std::size_t size) = 0;
+
+    /** start of the current window */
+    char* begin;
+    /** next position to write to */
+    char* cursor;
+    /** end of the current window */
+    char* end;
+    /** bytes that left the window, e.g. flushed to a stream */
+    std::size_t passed;
+};
+} // Serialization
+
+// include src, keeps the fast path inlineable
+#include "Writer.cpp"
+#endif //__WRITER_H__
@@ -0,0 +1,1578 @@
+/**
+ * @file Benchmark.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief benchmark suite of the serializers and deserializers
+ * @version 1.0
+ * @date 2020-08-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ * Build from the repository root with
+ *     g++ -std=c++2a -O2 -I. benchmark/Benchmark.cpp -o benchmark/benchmark
+ * and run with [--filter=text] [--samples=n] [--sample-ms=n] [--counters].
+ * Every case is printed as one line of json. --counters adds hardware
+ * counters per operation where perf_event_open(2) is allowed.
+ * The message cases decode a fresh object per operation, once with
+ * its memory from the heap and once from an Arena.
+ * The feature cases measure formatting numbers, escaping, bulk copies,
+ * containers, in situ and incremental reading, record files, the tagged
+ * and delta formats, calls and ParallelSerializer. Each checks its
+ * output once and is skipped with a note on stderr if it is wrong.
+ * Built with -DSERIALIZATION_INSTRUMENTATION the cases measure the
+ * instrumented serializers and the recorded statistics of each type
+ * follow the cases.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Arena.h"
+#include "BenchmarkRunner.h"
+#include "BufferWriter.h"
+#include "CallDispatcher.h"
+#include "CountingStreamBuffer.h"
+#include "Descriptor.h"
+#include "DeserializerBinary.h"
+#include "DeserializerDelta.h"
+#include "DeserializerJSON.h"
+#include "DeserializerTagged.h"
+#include "FloatFormatter.h"
+#include "IncrementalDeserializer.h"
+#include "Instrumentation.h"
+#include "IntegerFormatter.h"
+#include "JSONEscaper.h"
+#include "ParallelSerializer.h"
+#include "PerfCounters.h"
+#include "RecordFileReader.h"
+#include "RecordFileWriter.h"
+#include "SerializerBinary.h"
+#include "SerializerDelta.h"
+#include "SerializerJSON.h"
+#include "SerializerTagged.h"
+#include "SpanWriter.h"
+#include "StaticSerializerJSON.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <sys/socket.h>
+#include <unistd.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/**
+ * @brief smallest described class, nested by Nested
+ */
+struct InnerClass
+{
+    int a;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "InnerClass",
+        &InnerClass::a, "a", 1
+    );
+};
+
+/**
+ * @brief a few numbers of every kind
+ */
+struct Flat
+{
+    int id;
+    char mode;
+    int count;
+    bool active;
+    double value;
+    std::uint64_t timestamp;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Flat",
+        &Flat::id, "id", 1,
+        &Flat::mode, "mode", 2,
+        &Flat::count, "count", 3,
+        &Flat::active, "active", 4,
+        &Flat::value, "value", 5,
+        &Flat::timestamp, "timestamp", 6
+    );
+};
+
+/**
+ * @brief described classes inside of a described class
+ */
+struct Nested
+{
+    int id;
+    InnerClass first;
+    InnerClass second;
+    std::array<InnerClass, 4> children;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Nested",
+        &Nested::id, "id", 1,
+        &Nested::first, "first", 2,
+        &Nested::second, "second", 3,
+        &Nested::children, "children", 4
+    );
+};
+
+/**
+ * @brief many members, so per member costs dominate
+ */
+struct Wide
+{
+    int count0;
+    double level0;
+    int count1;
+    double level1;
+    int count2;
+    double level2;
+    int count3;
+    double level3;
+    int count4;
+    double level4;
+    int count5;
+    double level5;
+    int count6;
+    double level6;
+    int count7;
+    double level7;
+    int count8;
+    double level8;
+    int count9;
+    double level9;
+    int count10;
+    double level10;
+    int count11;
+    double level11;
+    int count12;
+    double level12;
+    int count13;
+    double level13;
+    int count14;
+    double level14;
+    int count15;
+    double level15;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Wide",
+        &Wide::count0, "count0", 1,
+        &Wide::level0, "level0", 2,
+        &Wide::count1, "count1", 3,
+        &Wide::level1, "level1", 4,
+        &Wide::count2, "count2", 5,
+        &Wide::level2, "level2", 6,
+        &Wide::count3, "count3", 7,
+        &Wide::level3, "level3", 8,
+        &Wide::count4, "count4", 9,
+        &Wide::level4, "level4", 10,
+        &Wide::count5, "count5", 11,
+        &Wide::level5, "level5", 12,
+        &Wide::count6, "count6", 13,
+        &Wide::level6, "level6", 14,
+        &Wide::count7, "count7", 15,
+        &Wide::level7, "level7", 16,
+        &Wide::count8, "count8", 17,
+        &Wide::level8, "level8", 18,
+        &Wide::count9, "count9", 19,
+        &Wide::level9, "level9", 20,
+        &Wide::count10, "count10", 21,
+        &Wide::level10, "level10", 22,
+        &Wide::count11, "count11", 23,
+        &Wide::level11, "level11", 24,
+        &Wide::count12, "count12", 25,
+        &Wide::level12, "level12", 26,
+        &Wide::count13, "count13", 27,
+        &Wide::level13, "level13", 28,
+        &Wide::count14, "count14", 29,
+        &Wide::level14, "level14", 30,
+        &Wide::count15, "count15", 31,
+        &Wide::level15, "level15", 32
+    );
+};
+
+/**
+ * @brief mostly text, some of it to be escaped in json
+ */
+struct Strings
+{
+    std::string name;
+    std::string path;
+    std::string agent;
+    std::string message;
+    std::string comment;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Strings",
+        &Strings::name, "name", 1,
+        &Strings::path, "path", 2,
+        &Strings::agent, "agent", 3,
+        &Strings::message, "message", 4,
+        &Strings::comment, "comment", 5
+    );
+};
+
+/**
+ * @brief short lived message owning its strings and containers
+ */
+struct Message
+{
+    std::uint64_t sequence;
+    std::pmr::string topic;
+    std::pmr::string sender;
+    std::pmr::vector<std::pmr::string> tags;
+    std::pmr::vector<std::int32_t> samples;
+    std::pmr::string payload;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Message",
+        &Message::sequence, "sequence", 1,
+        &Message::topic, "topic", 2,
+        &Message::sender, "sender", 3,
+        &Message::tags, "tags", 4,
+        &Message::samples, "samples", 5,
+        &Message::payload, "payload", 6
+    );
+};
+
+/**
+ * @brief plain message, its memory equals the binary encoding
+ */
+struct SensorSample
+{
+    int timestamp;
+    int value;
+    char channel;
+    char unit;
+    char quality;
+    char flags;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "SensorSample",
+        &SensorSample::timestamp, "timestamp",
+        &SensorSample::value, "value",
+        &SensorSample::channel, "channel",
+        &SensorSample::unit, "unit",
+        &SensorSample::quality, "quality",
+        &SensorSample::flags, "flags"
+    );
+};
+
+/**
+ * @brief message with container members, the samples are written in bulk
+ */
+struct Telemetry
+{
+    std::string device;
+    std::array<int, 3> position;
+    std::optional<int> battery;
+    std::vector<int> samples;
+    std::vector<SensorSample> events;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Telemetry",
+        &Telemetry::device, "device",
+        &Telemetry::position, "position",
+        &Telemetry::battery, "battery",
+        &Telemetry::samples, "samples",
+        &Telemetry::events, "events"
+    );
+};
+
+/**
+ * @brief message with fixed width integers and floating points
+ */
+struct Measurement
+{
+    std::int64_t time;
+    std::uint32_t sequence;
+    std::uint8_t channel;
+    float gain;
+    double value;
+    std::vector<double> spectrum;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Measurement",
+        &Measurement::time, "time", 1,
+        &Measurement::sequence, "sequence", 2,
+        &Measurement::channel, "channel", 3,
+        &Measurement::gain, "gain", 4,
+        &Measurement::value, "value", 5,
+        &Measurement::spectrum, "spectrum", 6
+    );
+};
+
+/**
+ * @brief Measurement as an older release described it, before channel,
+ * gain and spectrum were added
+ */
+struct LegacyMeasurement
+{
+    std::int64_t time;
+    std::uint32_t sequence;
+    double value;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Measurement",
+        &LegacyMeasurement::time, "time", 1,
+        &LegacyMeasurement::sequence, "sequence", 2,
+        &LegacyMeasurement::value, "value", 5
+    );
+};
+
+/**
+ * @brief log line with owning strings, each longer than the small string buffer
+ */
+struct AccessLog
+{
+    std::string host;
+    std::string path;
+    std::string agent;
+    int status;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "AccessLog",
+        &AccessLog::host, "host",
+        &AccessLog::path, "path",
+        &AccessLog::agent, "agent",
+        &AccessLog::status, "status"
+    );
+};
+
+/**
+ * @brief same log line viewing the input, deserialized in situ
+ */
+struct AccessLogView
+{
+    std::string_view host;
+    std::string_view path;
+    const char* agent;
+    int status;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "AccessLogView",
+        &AccessLogView::host, "host",
+        &AccessLogView::path, "path",
+        &AccessLogView::agent, "agent",
+        &AccessLogView::status, "status"
+    );
+};
+
+/**
+ * @brief nested part of DeviceState
+ */
+struct Pose
+{
+    int x;
+    int y;
+    int heading;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Pose",
+        &Pose::x, "x",
+        &Pose::y, "y",
+        &Pose::heading, "heading"
+    );
+};
+
+/**
+ * @brief periodic state message, most members stay the same from tick to tick
+ */
+struct DeviceState
+{
+    std::string name;
+    std::uint64_t tick;
+    int temperature;
+    char mode;
+    bool charging;
+    Pose pose;
+    std::vector<int> errors;
+    std::array<double, 4> calibration;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "DeviceState",
+        &DeviceState::name, "name",
+        &DeviceState::tick, "tick",
+        &DeviceState::temperature, "temperature",
+        &DeviceState::mode, "mode",
+        &DeviceState::charging, "charging",
+        &DeviceState::pose, "pose",
+        &DeviceState::errors, "errors",
+        &DeviceState::calibration, "calibration"
+    );
+};
+
+/**
+ * @brief controller whose functions are called by remote requests
+ */
+struct Thermostat
+{
+    int target;
+    double offset;
+    bool holding;
+
+    int setTarget(int value)
+    {
+        const int previous = target;
+        target = value;
+        return previous;
+    }
+
+    double calibrate(double measured, std::int16_t samples)
+    {
+        offset += (measured - target / 10.0 - offset) / samples;
+        return offset;
+    }
+
+    void hold(bool enabled)
+    {
+        holding = enabled;
+    }
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Thermostat",
+        &Thermostat::target, "target",
+        &Thermostat::offset, "offset",
+        &Thermostat::holding, "holding",
+        &Thermostat::setTarget, "setTarget", std::array<const char* const, 1>({"value"}),
+        &Thermostat::calibrate, "calibrate", std::array<const char* const, 2>({"measured", "samples"}),
+        &Thermostat::hold, "hold", std::array<const char* const, 1>({"enabled"})
+    );
+};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** bytes of the SpanWriter sink, enough for every shape */
+static constexpr std::size_t spanCapacity = 1 << 14;
+
+void* operator new(std::size_t size)
+{
+    Benchmark::BenchmarkRunner::countAllocation();
+    if (void* const memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+// used by std::pmr::new_delete_resource()
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    Benchmark::BenchmarkRunner::countAllocation();
+    const std::size_t bytes = static_cast<std::size_t>(alignment);
+    if (void* const memory = std::aligned_alloc(bytes, (size + bytes - 1) / bytes * bytes)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// not inlined, gcc would warn about free on memory of operator new otherwise
+[[gnu::noinline]] void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, std::size_t size) noexcept
+{
+    std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void* memory, std::size_t size) noexcept
+{
+    std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, std::align_val_t alignment) noexcept
+{
+    std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, std::size_t size, std::align_val_t alignment) noexcept
+{
+    std::free(memory);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief checks that disabled instrumentation leaves nothing behind:
+ * its scope has no state, nothing to destroy and runs at compile time.
+ *
+ * @tparam SerializeableT any class with static descriptor
+ * @return true if the scope compiles away
+ */
+template <class SerializeableT>
+constexpr bool isCompiledAway()
+{
+    using Scope = Serialization::NoInstrumentation::Scope<SerializeableT>;
+    Scope scope(Serialization::InstrumentedOperation::Serialize, 0);
+    scope.finish(1);
+    return std::is_empty_v<Scope> && std::is_trivially_destructible_v<Scope>;
+}
+
+static_assert(Serialization::Instrumentation::isEnabled || isCompiledAway<Flat>(),
+    "disabled instrumentation has to compile away");
+
+/**
+ * @brief serializes an object into each sink.
+ *
+ * @tparam SerializerT serializer to measure
+ * @tparam SerializeableT any class with static descriptor
+ * @param runner runs and reports the cases
+ * @param format name of the format
+ * @param shape name of the class
+ * @param object object to serialize
+ */
+template <class SerializerT, class SerializeableT>
+void benchmarkSerialize(
+    Benchmark::BenchmarkRunner& runner,
+    const char* const format,
+    const char* const shape,
+    const SerializeableT& object)
+{
+    SerializerT serializer;
+
+    Serialization::BufferWriter buffer;
+    runner.run({"serialize", format, shape, "buffer"}, [&]() {
+        buffer.clear();
+        serializer.serialize(buffer, object);
+        return buffer.getSize();
+    });
+
+    std::vector<char> memory(spanCapacity);
+    Serialization::SpanWriter span(memory.data(), memory.size());
+    runner.run({"serialize", format, shape, "span"}, [&]() {
+        span.clear();
+        serializer.serialize(span, object);
+        return span.getSize();
+    });
+
+    Benchmark::CountingStreamBuffer streamBuffer;
+    std::ostream stream(&streamBuffer);
+    runner.run({"serialize", format, shape, "ostream"}, [&]() {
+        streamBuffer.reset();
+        serializer.serialize(stream, object);
+        return streamBuffer.getCount();
+    });
+}
+
+/**
+ * @brief writes the structure of a class.
+ *
+ * @tparam SerializerT serializer to measure
+ * @tparam SerializeableT any class with static descriptor
+ * @param runner runs and reports the cases
+ * @param format name of the format
+ * @param shape name of the class
+ */
+template <class SerializerT, class SerializeableT>
+void benchmarkStructure(Benchmark::BenchmarkRunner& runner, const char* const format, const char* const shape)
+{
+    SerializerT serializer;
+    Serialization::BufferWriter buffer;
+    runner.run({"serializeStructure", format, shape, "buffer"}, [&]() {
+        buffer.clear();
+        serializer.template serializeStructure<SerializeableT>(buffer);
+        return buffer.getSize();
+    });
+}
+
+/**
+ * @brief reads the serialized object over and over again into the same object.
+ *
+ * @tparam SerializerT writes the input
+ * @tparam DeserializerT deserializer to measure
+ * @tparam SerializeableT any class with static descriptor
+ * @param runner runs and reports the cases
+ * @param format name of the format
+ * @param shape name of the class
+ * @param object object to serialize as input
+ */
+template <class SerializerT, class DeserializerT, class SerializeableT>
+void benchmarkDeserialize(
+    Benchmark::BenchmarkRunner& runner,
+    const char* const format,
+    const char* const shape,
+    const SerializeableT& object)
+{
+    SerializerT serializer;
+    Serialization::BufferWriter input;
+    serializer.serialize(input, object);
+
+    DeserializerT deserializer;
+    SerializeableT target = object;
+    const auto result = deserializer.deserialize(input.getData(), input.getSize(), target);
+    if (!result) {
+        std::cerr << "deserialize/" << format << "/" << shape << " skipped: " <<
+            Serialization::DeserializationResult::getDescription(result.getError()) << std::endl;
+        return;
+    }
+
+    runner.run({"deserialize", format, shape, "buffer"}, [&]() {
+        deserializer.deserialize(input.getData(), input.getSize(), target);
+        return input.getSize();
+    });
+}
+
+/**
+ * @brief decodes a fresh message per operation, as a receiver of many messages does.
+ *
+ * @details The heap case allocates every string and container on its
+ * own, the arena case takes them from an Arena that is reset after each
+ * message, so its allocations per operation show what is left on the heap.
+ *
+ * @tparam SerializerT writes the input
+ * @tparam DeserializerT deserializer to measure
+ * @param runner runs and reports the cases
+ * @param format name of the format
+ * @param message message to serialize as input
+ */
+template <class SerializerT, class DeserializerT>
+void benchmarkArena(Benchmark::BenchmarkRunner& runner, const char* const format, const Message& message)
+{
+    SerializerT serializer;
+    Serialization::BufferWriter input;
+    serializer.serialize(input, message);
+    DeserializerT deserializer;
+
+    runner.run({"deserialize", format, "message", "heap"}, [&]() {
+        Message target{};
+        deserializer.deserialize(input.getData(), input.getSize(), target);
+        return input.getSize();
+    });
+
+    Serialization::Arena arena;
+    runner.run({"deserialize", format, "message", "arena"}, [&]() {
+        {
+            Message target{};
+            deserializer.deserialize(input.getData(), input.getSize(), target, arena);
+        }
+        arena.reset();
+        return input.getSize();
+    });
+}
+
+/**
+ * @brief runs every operation, format and sink for one shape.
+ *
+ * @tparam SerializeableT any class with static descriptor and member ids
+ * @param runner runs and reports the cases
+ * @param shape name of the class
+ * @param object object to measure with
+ */
+template <class SerializeableT>
+void benchmarkShape(Benchmark::BenchmarkRunner& runner, const char* const shape, const SerializeableT& object)
+{
+    benchmarkSerialize<Serialization::JSONSerializer>(runner, "json", shape, object);
+    benchmarkSerialize<Serialization::StaticJSONSerializer>(runner, "static-json", shape, object);
+    benchmarkSerialize<Serialization::BinarySerializer>(runner, "binary", shape, object);
+    benchmarkSerialize<Serialization::TaggedSerializer>(runner, "tagged", shape, object);
+
+    benchmarkStructure<Serialization::JSONSerializer, SerializeableT>(runner, "json", shape);
+    benchmarkStructure<Serialization::StaticJSONSerializer, SerializeableT>(runner, "static-json", shape);
+    benchmarkStructure<Serialization::BinarySerializer, SerializeableT>(runner, "binary", shape);
+
+    benchmarkDeserialize<Serialization::JSONSerializer, Serialization::JSONDeserializer>(runner, "json", shape, object);
+    benchmarkDeserialize<Serialization::BinarySerializer, Serialization::BinaryDeserializer>(runner, "binary", shape, object);
+    benchmarkDeserialize<Serialization::TaggedSerializer, Serialization::TaggedDeserializer>(runner, "tagged", shape, object);
+}
+
+/**
+ * @brief formats a block of integers per operation with IntegerFormatter,
+ * std::to_chars and a std::ostream, for values spread over the full int
+ * range and for small values.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkIntegers(Benchmark::BenchmarkRunner& runner)
+{
+    constexpr std::size_t count = 1024;
+    constexpr std::size_t maxLength = Serialization::IntegerFormatter::maxLength<int>;
+    std::vector<int> fullRange;
+    std::vector<int> small;
+    fullRange.reserve(count);
+    small.reserve(count);
+
+    // xorshift, uniform over all 32 bit patterns
+    std::uint32_t state = 2463534242u;
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        fullRange.push_back(static_cast<int>(state));
+        small.push_back(static_cast<int>(state % 128));
+    }
+    fullRange[0] = std::numeric_limits<int>::min();
+    fullRange[1] = std::numeric_limits<int>::max();
+    fullRange[2] = 0;
+
+    std::string output(count * (maxLength + 1), '\0');
+    const auto formatAll = [&output](const std::vector<int>& values, auto format) {
+        char* end = output.data();
+        for (const int value : values) {
+            end = format(end, value);
+            *end++ = ',';
+        }
+        return static_cast<std::size_t>(end - output.data());
+    };
+    const auto toChars = [](char* const position, const int value) {
+        return std::to_chars(position, position + maxLength, value).ptr;
+    };
+    const auto integerFormatter = [](char* const position, const int value) {
+        return Serialization::IntegerFormatter::format(position, value);
+    };
+
+    Benchmark::CountingStreamBuffer streamBuffer;
+    std::ostream stream(&streamBuffer);
+    for (const auto& input : {std::make_pair("int-full-range", &fullRange), std::make_pair("int-small", &small)}) {
+        const char* const shape = input.first;
+        const std::vector<int>& values = *input.second;
+
+        runner.run({"format", "to_chars", shape, "buffer"}, [&]() {
+            return formatAll(values, toChars);
+        });
+
+        const std::string reference = output.substr(0, formatAll(values, toChars));
+        if (output.substr(0, formatAll(values, integerFormatter)) != reference) {
+            std::cerr << "format/IntegerFormatter/" << shape << " skipped: output differs from std::to_chars" << std::endl;
+        } else {
+            runner.run({"format", "IntegerFormatter", shape, "buffer"}, [&]() {
+                return formatAll(values, integerFormatter);
+            });
+        }
+
+        runner.run({"format", "ostream", shape, "ostream"}, [&]() {
+            streamBuffer.reset();
+            for (const int value : values) {
+                stream << value << ',';
+            }
+            return streamBuffer.getCount();
+        });
+    }
+}
+
+/**
+ * @brief formats a block of doubles per operation, shortest round trip
+ * with FloatFormatter and with a std::ostream at max_digits10, which also
+ * round trips but is longer.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkFloats(Benchmark::BenchmarkRunner& runner)
+{
+    constexpr std::size_t count = 1024;
+    std::vector<double> values;
+    values.reserve(count);
+
+    // xorshift, mantissas of all lengths over a wide exponent range
+    std::uint64_t state = 88172645463325252ull;
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const double mantissa = static_cast<double>(state >> 11) / static_cast<double>(1ull << 53);
+        values.push_back(((ii % 4) == 0) ?
+            std::round(mantissa * 1000) / 100 :
+            std::ldexp(mantissa, static_cast<int>(state % 128) - 64));
+    }
+
+    std::string output(count * (Serialization::FloatFormatter::maxLength<double> + 1), '\0');
+    const auto formatAll = [&]() {
+        char* end = output.data();
+        for (const double value : values) {
+            end = Serialization::FloatFormatter::format(end, value);
+            *end++ = ',';
+        }
+        return static_cast<std::size_t>(end - output.data());
+    };
+
+    // every value has to read back to the same bits
+    const std::size_t size = formatAll();
+    std::size_t mismatches = 0;
+    const char* position = output.data();
+    for (const double value : values) {
+        double parsed = 0;
+        position = std::from_chars(position, output.data() + size, parsed).ptr + 1;
+        mismatches += (std::bit_cast<std::uint64_t>(parsed) != std::bit_cast<std::uint64_t>(value)) ? 1 : 0;
+    }
+    if (mismatches != 0) {
+        std::cerr << "format/FloatFormatter/double skipped: " << mismatches << " values do not read back" << std::endl;
+    } else {
+        runner.run({"format", "FloatFormatter", "double", "buffer"}, formatAll);
+    }
+
+    Benchmark::CountingStreamBuffer streamBuffer;
+    std::ostream stream(&streamBuffer);
+    stream.precision(std::numeric_limits<double>::max_digits10);
+    runner.run({"format", "ostream", "double", "ostream"}, [&]() {
+        streamBuffer.reset();
+        for (const double value : values) {
+            stream << value << ',';
+        }
+        return streamBuffer.getCount();
+    });
+}
+
+/**
+ * @brief escapes a long log line with a few characters to escape, with
+ * each search of JSONEscaper the cpu supports.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkEscaping(Benchmark::BenchmarkRunner& runner)
+{
+    std::string line;
+    while (line.size() < 4096) {
+        line += "2020-07-31 12:00:00 [info] sensor 17 reports \"ok\", value within limits\t";
+    }
+
+    const auto escape = [&line](Serialization::Writer& writer, const Serialization::JSONEscaper::FindFunction findEscape) {
+        const char* const end = line.data() + line.size();
+        const char* runStart = line.data();
+        while (runStart != end) {
+            const char* const position = findEscape(runStart, end);
+            writer.write(runStart, position - runStart);
+            if (position == end) {
+                break;
+            }
+            Serialization::JSONEscaper::write(writer, *position);
+            runStart = position + 1;
+        }
+    };
+
+    const std::array<std::pair<const char*, Serialization::JSONEscaper::FindFunction>, 4> implementations = {{
+        {"scalar", &Serialization::JSONEscaper::findEscapeScalar},
+        {"SSE2", &Serialization::JSONEscaper::findEscapeSSE2},
+        {"AVX2", &Serialization::JSONEscaper::findEscapeAVX2},
+        {"selected", Serialization::JSONEscaper::getFindFunction()}}};
+
+    Serialization::BufferWriter reference(2 * line.size());
+    escape(reference, &Serialization::JSONEscaper::findEscapeScalar);
+    Serialization::BufferWriter writer(2 * line.size());
+    for (const auto& implementation : implementations) {
+        if ((implementation.second == &Serialization::JSONEscaper::findEscapeAVX2) &&
+            (Serialization::JSONEscaper::getFindFunction() != implementation.second)) {
+            std::cerr << "escape/" << implementation.first << "/log-line skipped: not supported" << std::endl;
+            continue;
+        }
+
+        writer.clear();
+        escape(writer, implementation.second);
+        if ((writer.getSize() != reference.getSize()) ||
+            (std::memcmp(writer.getData(), reference.getData(), reference.getSize()) != 0)) {
+            std::cerr << "escape/" << implementation.first << "/log-line skipped: output differs from the scalar search" <<
+                std::endl;
+            continue;
+        }
+
+        runner.run({"escape", implementation.first, "log-line", "buffer"}, [&]() {
+            writer.clear();
+            escape(writer, implementation.second);
+            return line.size();
+        });
+    }
+}
+
+/**
+ * @brief writes a block of plain objects member by member, as a whole
+ * and as one array.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkBulkCopy(Benchmark::BenchmarkRunner& runner)
+{
+    constexpr std::size_t count = 1024;
+    std::vector<SensorSample> samples(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        samples[ii] = SensorSample{static_cast<int>(ii), static_cast<int>(ii * 7), 'a', 'V', 100, 0};
+    }
+
+    Serialization::BinarySerializer serializer;
+    Serialization::Serializer& perMember = serializer;
+    Serialization::BufferWriter writer(count * sizeof(SensorSample));
+
+    serializer.serializeArray(writer, samples.data(), samples.size());
+    std::vector<SensorSample> decoded(count);
+    Serialization::BinaryDeserializer deserializer;
+    const auto result = deserializer.deserializeArray(writer.getData(), writer.getSize(), decoded.data(), decoded.size());
+    if (!result || (std::memcmp(decoded.data(), samples.data(), count * sizeof(SensorSample)) != 0)) {
+        std::cerr << "serialize/binary/samples skipped: the samples do not read back" << std::endl;
+        return;
+    }
+
+    runner.run({"serialize", "binary-per-member", "samples", "buffer"}, [&]() {
+        writer.clear();
+        for (const SensorSample& sample : samples) {
+            perMember.serialize(writer, sample);
+        }
+        return writer.getSize();
+    });
+    runner.run({"serialize", "binary", "samples", "buffer"}, [&]() {
+        writer.clear();
+        for (const SensorSample& sample : samples) {
+            serializer.serialize(writer, sample);
+        }
+        return writer.getSize();
+    });
+    runner.run({"serializeArray", "binary", "samples", "buffer"}, [&]() {
+        writer.clear();
+        serializer.serializeArray(writer, samples.data(), samples.size());
+        return writer.getSize();
+    });
+}
+
+/**
+ * @brief writes a message holding thousands of integers in a std::vector,
+ * into a reused buffer and into a fresh one per message, growing while
+ * writing or sized by serializedSize(...) up front.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkContainers(Benchmark::BenchmarkRunner& runner)
+{
+    constexpr std::size_t count = 4096;
+    Telemetry telemetry{"sensor-7", {1, -2, 3}, 87, std::vector<int>(count), {}};
+    std::iota(telemetry.samples.begin(), telemetry.samples.end(), -1000);
+
+    Serialization::JSONSerializer jsonSerializer;
+    Serialization::StaticJSONSerializer staticSerializer;
+    Serialization::BinarySerializer binarySerializer;
+    Serialization::BufferWriter json;
+    Serialization::BufferWriter binary;
+    jsonSerializer.serialize(json, telemetry);
+    binarySerializer.serialize(binary, telemetry);
+
+    Telemetry fromJSON;
+    Serialization::JSONDeserializer jsonDeserializer;
+    const auto jsonResult = jsonDeserializer.deserialize(json.getData(), json.getSize(), fromJSON);
+    Telemetry fromBinary;
+    Serialization::BinaryDeserializer binaryDeserializer;
+    const auto binaryResult = binaryDeserializer.deserialize(binary.getData(), binary.getSize(), fromBinary);
+    if (!jsonResult || !binaryResult || (fromJSON.samples != telemetry.samples) || (fromBinary.samples != telemetry.samples)) {
+        std::cerr << "serialize/*/telemetry skipped: the samples do not read back" << std::endl;
+        return;
+    }
+
+    const auto measure = [&](const char* const format, auto& serializer, Serialization::BufferWriter& writer) {
+        runner.run({"serialize", format, "telemetry", "buffer"}, [&]() {
+            writer.clear();
+            serializer.serialize(writer, telemetry);
+            return writer.getSize();
+        });
+    };
+    measure("json", jsonSerializer, json);
+    measure("static-json", staticSerializer, json);
+    measure("binary", binarySerializer, binary);
+
+    runner.run({"serialize", "static-json", "telemetry", "new-buffer"}, [&]() {
+        Serialization::BufferWriter writer(0);
+        staticSerializer.serialize(writer, telemetry);
+        return writer.getSize();
+    });
+    runner.run({"serialize", "static-json", "telemetry", "sized-buffer"}, [&]() {
+        Serialization::BufferWriter writer(Serialization::JSONSerializer::serializedSize(telemetry));
+        staticSerializer.serialize(writer, telemetry);
+        return writer.getSize();
+    });
+}
+
+/**
+ * @brief reads log lines into std::string members and in situ into views.
+ *
+ * @details The message is copied into one mutable buffer before every
+ * read, like a receive would.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkInSitu(Benchmark::BenchmarkRunner& runner)
+{
+    const AccessLog log{"edge-17.eu-central.example.net", "/api/v2/devices/4711/telemetry?since=1597363200",
+        "Mozilla/5.0 (X11; Linux x86_64) \"probe\"", 200};
+
+    Serialization::BinarySerializer binarySerializer;
+    Serialization::JSONSerializer jsonSerializer;
+    Serialization::BufferWriter json;
+    Serialization::BufferWriter binary;
+    jsonSerializer.serialize(json, log);
+    binarySerializer.serialize(binary, log);
+
+    const auto measure = [&](
+        const char* const format,
+        const char* const sink,
+        const Serialization::BufferWriter& input,
+        auto deserialize) {
+        std::vector<char> buffer(input.getSize());
+        const auto receive = [&]() {
+            std::memcpy(buffer.data(), input.getData(), buffer.size());
+            return deserialize(buffer.data(), buffer.size());
+        };
+        if (!receive()) {
+            std::cerr << "deserialize/" << format << "/access-log/" << sink << " skipped: the log does not read back" <<
+                std::endl;
+            return;
+        }
+        runner.run({"deserialize", format, "access-log", sink}, [&]() {
+            receive();
+            return buffer.size();
+        });
+    };
+
+    Serialization::JSONDeserializer jsonDeserializer;
+    Serialization::BinaryDeserializer binaryDeserializer;
+    measure("json", "string", json, [&](char* data, std::size_t size) {
+        AccessLog copy{};
+        return static_cast<bool>(jsonDeserializer.deserialize(data, size, copy)) && (copy.path == log.path);
+    });
+    measure("json", "in-situ", json, [&](char* data, std::size_t size) {
+        AccessLogView view{};
+        return static_cast<bool>(jsonDeserializer.deserializeInSitu(data, size, view)) && (view.path == log.path);
+    });
+    measure("binary", "string", binary, [&](char* data, std::size_t size) {
+        AccessLog copy{};
+        return static_cast<bool>(binaryDeserializer.deserialize(data, size, copy)) && (copy.agent == log.agent);
+    });
+    measure("binary", "in-situ", binary, [&](char* data, std::size_t size) {
+        AccessLogView view{};
+        return static_cast<bool>(binaryDeserializer.deserializeInSitu(data, size, view)) && (view.agent == log.agent);
+    });
+}
+
+/**
+ * @brief sends a stream of Telemetry messages through a socketpair and
+ * reads it with IncrementalDeserializer, then times pushing the same
+ * fragments again, the whole stream per operation.
+ *
+ * @details A second thread writes the stream in random sizes, the reader
+ * pushes whatever read() returns and checks every object. The sizes
+ * read() returned are kept, so the timed operation reads the fragments
+ * the socket produced without the system calls.
+ *
+ * @tparam SerializerT serializer writing the stream
+ * @tparam DeserializerT deserializer matching SerializerT
+ * @param runner runs and reports the cases
+ * @param format name of the format
+ */
+template <class SerializerT, class DeserializerT>
+void benchmarkIncremental(Benchmark::BenchmarkRunner& runner, const char* const format)
+{
+    constexpr std::size_t count = 2000;
+    std::vector<Telemetry> messages;
+    Serialization::BufferWriter stream;
+    SerializerT serializer;
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        Telemetry telemetry{"sensor-" + std::to_string(ii), {1, -2, static_cast<int>(ii)},
+            (ii % 3) ? std::optional<int>(ii % 100) : std::nullopt, std::vector<int>(ii % 50, -7), {}};
+        for (std::size_t event = 0; event < ii % 4; ++event) {
+            telemetry.events.push_back(SensorSample{static_cast<int>(event), 8, 'a', '"', '{', '}'});
+        }
+        serializer.serialize(stream, telemetry);
+        messages.push_back(std::move(telemetry));
+    }
+
+    std::mt19937 random(7);
+    for (const auto& fragmentation : {std::make_pair(1, "fragments-1"), std::make_pair(16, "fragments-16"),
+        std::make_pair(256, "fragments-256"), std::make_pair(65536, "fragments-65536")}) {
+        const std::size_t maxFragment = fragmentation.first;
+        const char* const sink = fragmentation.second;
+
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+            std::cerr << "push/" << format << "/telemetry/" << sink << " skipped: socketpair failed" << std::endl;
+            continue;
+        }
+        std::thread sender([&stream, &sockets, maxFragment, seed = random()]() {
+            std::mt19937 random(seed);
+            for (std::size_t offset = 0; offset < stream.getSize();) {
+                const std::size_t size = std::min<std::size_t>(1 + random() % maxFragment, stream.getSize() - offset);
+                const ssize_t sent = write(sockets[0], stream.getData() + offset, size);
+                if (sent <= 0) {
+                    break;
+                }
+                offset += sent;
+            }
+            close(sockets[0]);
+        });
+
+        Serialization::IncrementalDeserializer<Telemetry, DeserializerT> reader;
+        std::vector<char> buffer(maxFragment);
+        std::vector<std::size_t> fragments;
+        std::size_t received = 0;
+        std::size_t mismatches = 0;
+        Serialization::DeserializationResult result(Serialization::DeserializationError::None, 0);
+        for (;;) {
+            const ssize_t size = read(sockets[1], buffer.data(), 1 + random() % maxFragment);
+            if (size <= 0) {
+                break;
+            }
+            fragments.push_back(size);
+            result = reader.push(buffer.data(), size, [&](Telemetry& telemetry) {
+                const Telemetry& expected = messages[received++ % count];
+                mismatches += ((telemetry.device == expected.device) && (telemetry.samples == expected.samples) &&
+                    (telemetry.battery == expected.battery) && (telemetry.events.size() == expected.events.size())) ? 0 : 1;
+            });
+        }
+        sender.join();
+        close(sockets[1]);
+        if (!result || (received != count) || (mismatches != 0) || reader.hasPartialObject()) {
+            std::cerr << "push/" << format << "/telemetry/" << sink << " skipped: " << received << " messages, " <<
+                mismatches << " mismatches, " << Serialization::DeserializationResult::getDescription(result.getError()) <<
+                std::endl;
+            continue;
+        }
+
+        runner.run({"push", format, "telemetry", sink}, [&]() {
+            const char* position = stream.getData();
+            for (const std::size_t size : fragments) {
+                reader.push(position, size, [](Telemetry& telemetry) {});
+                position += size;
+            }
+            return stream.getSize();
+        });
+    }
+}
+
+/**
+ * @brief writes a day of Measurements to a record file, then opens it,
+ * fetches single records, an hour found by its time and all records.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkRecordFile(Benchmark::BenchmarkRunner& runner)
+{
+    constexpr std::size_t count = 86400;
+    constexpr std::int64_t start = 1597363200;
+    constexpr const char* path = "/tmp/serialization-records.bin";
+    std::vector<Measurement> day;
+    day.reserve(count);
+    for (std::size_t second = 0; second < count; ++second) {
+        day.push_back(Measurement{static_cast<std::int64_t>(start + second), static_cast<std::uint32_t>(second),
+            static_cast<std::uint8_t>(second % 8), 1.5f, second * 0.25, std::vector<double>(second % 16, 0.5)});
+    }
+
+    const auto write = [&]() {
+        Serialization::RecordFileWriter<Measurement> writer;
+        bool written = writer.open(path);
+        for (const Measurement& measurement : day) {
+            written = writer.append(measurement) && written;
+        }
+        return writer.close() && written;
+    };
+    Serialization::RecordFileReader<Measurement> reader;
+    if (!write() || !reader.open(path) || (reader.getCount() != count)) {
+        std::cerr << "*/record-file/measurement skipped: can not write and read " << path << std::endl;
+        std::remove(path);
+        return;
+    }
+
+    const auto getTime = [](const Measurement& measurement) {
+        return measurement.time;
+    };
+    const std::size_t first = reader.lowerBound(start + 12 * 3600, getTime);
+    const std::size_t last = reader.lowerBound(start + 13 * 3600, getTime);
+    std::size_t hourBytes = 0;
+    std::size_t allBytes = 0;
+    for (std::size_t index = 0; index < count; ++index) {
+        const std::size_t size = reader.getRecord(index).size();
+        hourBytes += ((index >= first) && (index < last)) ? size : 0;
+        allBytes += size;
+    }
+
+    runner.run({"write", "record-file", "measurement", "file"}, [&]() {
+        write();
+        return allBytes;
+    });
+
+    Serialization::RecordFileReader<Measurement> opened;
+    runner.run({"open", "record-file", "measurement", "file"}, [&]() {
+        opened.open(path);
+        opened.close();
+        return std::size_t(0);
+    });
+
+    // single records at random positions
+    std::mt19937 random(3);
+    std::vector<std::size_t> indices(1024);
+    for (std::size_t& index : indices) {
+        index = random() % count;
+    }
+    std::size_t lookup = 0;
+    Measurement measurement{};
+    runner.run({"read", "record-file", "measurement", "file"}, [&]() {
+        const std::size_t index = indices[lookup++ % indices.size()];
+        reader.read(index, measurement);
+        return reader.getRecord(index).size();
+    });
+
+    // one hour found by binary search on the time
+    runner.run({"readHour", "record-file", "measurement", "file"}, [&]() {
+        reader.forEach(reader.lowerBound(start + 12 * 3600, getTime), reader.lowerBound(start + 13 * 3600, getTime),
+            [](Measurement& measurement) {});
+        return hourBytes;
+    });
+
+    // everything, as a file without index would have to
+    runner.run({"readAll", "record-file", "measurement", "file"}, [&]() {
+        reader.forEach(0, reader.getCount(), [](Measurement& measurement) {});
+        return allBytes;
+    });
+
+    reader.close();
+    std::remove(path);
+}
+
+/**
+ * @brief writes and reads a Measurement in the fixed layout binary format
+ * and the tagged format, also read by a reader of an older descriptor that
+ * skips the new fields.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkTagged(Benchmark::BenchmarkRunner& runner)
+{
+    const Measurement measurement{1597363200, 17, 3, 1.5f, 0.25, std::vector<double>(8, 0.5)};
+
+    const auto measure = [&](const char* const format, const char* const shape, auto& serializer, auto& deserializer, auto target) {
+        Serialization::BufferWriter writer;
+        serializer.serialize(writer, measurement);
+        if (!deserializer.deserialize(writer.getData(), writer.getSize(), target) || (target.sequence != measurement.sequence)) {
+            std::cerr << "deserialize/" << format << "/" << shape << " skipped: the measurement does not read back" <<
+                std::endl;
+            return;
+        }
+        runner.run({"deserialize", format, shape, "buffer"}, [&]() {
+            deserializer.deserialize(writer.getData(), writer.getSize(), target);
+            return writer.getSize();
+        });
+    };
+
+    Serialization::BinarySerializer binarySerializer;
+    Serialization::BinaryDeserializer binaryDeserializer;
+    Serialization::TaggedSerializer taggedSerializer;
+    Serialization::TaggedDeserializer taggedDeserializer;
+    Serialization::BufferWriter writer;
+    runner.run({"serialize", "binary", "measurement", "buffer"}, [&]() {
+        writer.clear();
+        binarySerializer.serialize(writer, measurement);
+        return writer.getSize();
+    });
+    runner.run({"serialize", "tagged", "measurement", "buffer"}, [&]() {
+        writer.clear();
+        taggedSerializer.serialize(writer, measurement);
+        return writer.getSize();
+    });
+    measure("binary", "measurement", binarySerializer, binaryDeserializer, Measurement{});
+    measure("tagged", "measurement", taggedSerializer, taggedDeserializer, Measurement{});
+    measure("tagged", "legacy-measurement", taggedSerializer, taggedDeserializer, LegacyMeasurement{});
+}
+
+/**
+ * @brief sends a DeviceState every tick, in full and as delta to the
+ * previous one, and applies the deltas.
+ *
+ * @details The ticks are made once and repeat, the first delta is the
+ * one from the last tick.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkDelta(Benchmark::BenchmarkRunner& runner)
+{
+    constexpr std::size_t ticks = 1000;
+    std::vector<DeviceState> states(ticks,
+        DeviceState{"greenhouse-controller-3", 0, 215, 'A', false, {1200, -340, 90}, {}, {1.0, 0.98, 1.02, 0.5}});
+    for (std::size_t tick = 1; tick < ticks; ++tick) {
+        // the tick changes every time, the temperature now and then, the pose rarely
+        DeviceState& state = states[tick];
+        state = states[tick - 1];
+        state.tick = tick;
+        if (tick % 10 == 0) {
+            state.temperature += (tick % 20 == 0) ? 1 : -1;
+        }
+        if (tick % 100 == 0) {
+            state.pose.heading = static_cast<int>(tick / 100 % 360);
+        }
+    }
+    const auto previous = [&](const std::size_t tick) -> const DeviceState& {
+        return states[(tick + ticks - 1) % ticks];
+    };
+
+    Serialization::DeltaSerializer deltaSerializer;
+    Serialization::DeltaDeserializer deltaDeserializer;
+    Serialization::BufferWriter writer;
+    std::vector<std::string> deltas(ticks);
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        writer.clear();
+        deltaSerializer.serialize(writer, states[tick], previous(tick));
+        deltas[tick].assign(writer.getData(), writer.getSize());
+    }
+
+    DeviceState received = states.back();
+    std::size_t mismatches = 0;
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        const auto result = deltaDeserializer.deserialize(deltas[tick].data(), deltas[tick].size(), received);
+        mismatches += (result && Serialization::DeltaSerializer::isEqual(received, states[tick])) ? 0 : 1;
+    }
+    if (mismatches != 0) {
+        std::cerr << "*/delta/device-state skipped: " << mismatches << " mismatches after applying" << std::endl;
+        return;
+    }
+
+    Serialization::BinarySerializer binarySerializer;
+    std::size_t tick = 0;
+    runner.run({"serialize", "binary", "device-state", "buffer"}, [&]() {
+        tick = (tick + 1) % ticks;
+        writer.clear();
+        binarySerializer.serialize(writer, states[tick]);
+        return writer.getSize();
+    });
+    runner.run({"serialize", "delta", "device-state", "buffer"}, [&]() {
+        tick = (tick + 1) % ticks;
+        writer.clear();
+        deltaSerializer.serialize(writer, states[tick], previous(tick));
+        return writer.getSize();
+    });
+
+    // received holds the last tick, so the deltas apply in order
+    tick = ticks - 1;
+    runner.run({"deserialize", "delta", "device-state", "buffer"}, [&]() {
+        tick = (tick + 1) % ticks;
+        deltaDeserializer.deserialize(deltas[tick].data(), deltas[tick].size(), received);
+        return deltas[tick].size();
+    });
+}
+
+/**
+ * @brief calls a function of a Thermostat from json and binary requests.
+ *
+ * @param runner runs and reports the cases
+ */
+void benchmarkDispatch(Benchmark::BenchmarkRunner& runner)
+{
+    const std::string jsonRequest = "{\"calibrate\": [21.7, 8]}";
+
+    Serialization::BinarySerializer binarySerializer;
+    Serialization::BufferWriter binaryRequest;
+    binarySerializer.serialize(binaryRequest, std::string_view("calibrate"));
+    binarySerializer.serialize(binaryRequest, 21.7);
+    binarySerializer.serialize(binaryRequest, std::int16_t(8));
+
+    Serialization::CallDispatcher<Thermostat> dispatcher;
+    Serialization::BufferWriter writer(64);
+    Thermostat thermostat{215, 0.0, false};
+
+    for (const char* const format : {"json", "binary"}) {
+        const bool isJSON = std::strcmp(format, "json") == 0;
+        const char* const data = isJSON ? jsonRequest.data() : binaryRequest.getData();
+        const std::size_t size = isJSON ? jsonRequest.size() : binaryRequest.getSize();
+        const auto dispatch = [&]() {
+            writer.clear();
+            return isJSON ?
+                dispatcher.dispatchJSON(data, size, thermostat, writer) :
+                dispatcher.dispatchBinary(data, size, thermostat, writer);
+        };
+
+        const auto result = dispatch();
+        if (!result) {
+            std::cerr << "dispatch/" << format << "/thermostat skipped: " <<
+                Serialization::DeserializationResult::getDescription(result.getError()) << std::endl;
+            continue;
+        }
+        runner.run({"dispatch", format, "thermostat", "buffer"}, [&]() {
+            dispatch();
+            return size;
+        });
+    }
+}
+
+/**
+ * @brief serializes a large range on one thread and with ParallelSerializer
+ * on 1 to all hardware threads.
+ *
+ * @tparam SerializerT serializer used by each thread
+ * @tparam SerializeableT any class with static descriptor
+ * @param runner runs and reports the cases
+ * @param format name of the format
+ * @param shape name of the class
+ * @param object object to serialize over and over again
+ */
+template <class SerializerT, class SerializeableT>
+void benchmarkParallel(
+    Benchmark::BenchmarkRunner& runner,
+    const char* const format,
+    const char* const shape,
+    const SerializeableT& object)
+{
+    constexpr std::size_t count = 1 << 17;
+    const std::vector<SerializeableT> objects(count, object);
+
+    SerializerT serializer;
+    Serialization::BufferWriter reference;
+    serializer.serializeRange(reference, objects);
+    Serialization::BufferWriter writer(reference.getSize());
+    runner.run({"serializeRange", format, shape, "buffer"}, [&]() {
+        writer.clear();
+        serializer.serializeRange(writer, objects);
+        return writer.getSize();
+    });
+
+    const std::size_t maxThreads = std::max<std::size_t>(
+        Serialization::ParallelSerializer<SerializerT>::getHardwareThreadCount(), 2);
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (const std::size_t threads : threadCounts) {
+        const std::string sink = "threads-" + std::to_string(threads);
+        Serialization::ParallelSerializer<SerializerT> parallel(threads);
+        writer.clear();
+        parallel.serializeRange(writer, objects);
+        if ((writer.getSize() != reference.getSize()) ||
+            (std::memcmp(writer.getData(), reference.getData(), reference.getSize()) != 0)) {
+            std::cerr << "serializeRange/" << format << "/" << shape << "/" << sink <<
+                " skipped: output differs from serializeRange(...)" << std::endl;
+            continue;
+        }
+
+        runner.run({"serializeRange", format, shape, sink.c_str()}, [&]() {
+            writer.clear();
+            parallel.serializeRange(writer, objects);
+            return writer.getSize();
+        });
+    }
+}
+
+/**
+ * @brief reads the number of an option like --samples=5
+ *
+ * @param argument command line argument
+ * @param option option including the '='
+ * @param value set to the number if the argument is the option
+ * @return true if the argument is the option
+ */
+bool readOption(const std::string_view argument, const std::string_view option, std::size_t& value)
+{
+    if (argument.substr(0, option.size()) != option) {
+        return false;
+    }
+    const std::string_view number = argument.substr(option.size());
+    std::from_chars(number.data(), number.data() + number.size(), value);
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    std::size_t samples = 5;
+    std::size_t sampleMilliseconds = 10;
+    std::unique_ptr<Benchmark::PerfCounters> counters;
+    for (int ii = 1; ii < argc; ++ii) {
+        const std::string_view argument = argv[ii];
+        if (argument.substr(0, 9) == "--filter=") {
+            filter = argument.substr(9);
+        } else if (argument == "--counters") {
+            counters = std::make_unique<Benchmark::PerfCounters>();
+        } else if (!readOption(argument, "--samples=", samples) &&
+            !readOption(argument, "--sample-ms=", sampleMilliseconds)) {
+            std::cerr << "usage: " << argv[0] <<
+                " [--filter=text] [--samples=n] [--sample-ms=n] [--counters]" << std::endl;
+            return 1;
+        }
+    }
+
+    if ((counters != nullptr) && (counters->getError() != 0)) {
+        std::cerr << (counters->isAvailable() ? "some" : "no") << " hardware counters available (" <<
+            std::strerror(counters->getError()) << "), missing ones are reported as null" << std::endl;
+    }
+
+    Benchmark::BenchmarkRunner runner(
+        std::cout,
+        filter,
+        samples,
+        std::chrono::milliseconds(sampleMilliseconds),
+        counters.get());
+
+    const Flat flat{42, 'A', -1200, true, 3.14159, 1598824800123};
+    const Nested nested{7, {1}, {-2}, {{{3}, {400}, {-50000}, {6}}}};
+    const Wide wide{-200, 0.1, -163, 1.35, -126, 2.6, -89, 3.85, -52, 5.1, -15, 6.35, 22, 7.6, 59, 8.85, 96, 10.1, 133, 11.35, 170, 12.6, 207, 13.85, 244, 15.1, 281, 16.35, 318, 17.6, 355, 18.85};
+    const Strings strings{
+        "greenhouse-controller-3",
+        "/api/v1/sensors/temperature/history?from=2020-08-01&to=2020-08-31",
+        "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko)",
+        "line one\nline \"two\"\twith a tab and a backslash \\",
+        "short"};
+
+    benchmarkShape(runner, "flat", flat);
+    benchmarkShape(runner, "nested", nested);
+    benchmarkShape(runner, "wide", wide);
+    benchmarkShape(runner, "strings", strings);
+
+    Message message{
+        1598824800123,
+        "greenhouse/3/climate/temperature",
+        "greenhouse-controller-3.local",
+        {"celsius", "calibrated sensor with offset correction", "averaged over sixty seconds"},
+        {215, 216, 216, 217, 219, 220, 220, 221},
+        "{\"status\": \"ok\", \"window\": \"half open\", \"heating\": false}"};
+    benchmarkArena<Serialization::JSONSerializer, Serialization::JSONDeserializer>(runner, "json", message);
+    benchmarkArena<Serialization::BinarySerializer, Serialization::BinaryDeserializer>(runner, "binary", message);
+    benchmarkArena<Serialization::TaggedSerializer, Serialization::TaggedDeserializer>(runner, "tagged", message);
+
+    benchmarkIntegers(runner);
+    benchmarkFloats(runner);
+    benchmarkEscaping(runner);
+    benchmarkBulkCopy(runner);
+    benchmarkContainers(runner);
+    benchmarkInSitu(runner);
+    benchmarkIncremental<Serialization::JSONSerializer, Serialization::JSONDeserializer>(runner, "json");
+    benchmarkIncremental<Serialization::BinarySerializer, Serialization::BinaryDeserializer>(runner, "binary");
+    benchmarkRecordFile(runner);
+    benchmarkTagged(runner);
+    benchmarkDelta(runner);
+    benchmarkDispatch(runner);
+    benchmarkParallel<Serialization::JSONSerializer>(runner, "json", "flat", flat);
+    benchmarkParallel<Serialization::StaticJSONSerializer>(runner, "static-json", "flat", flat);
+
+#ifdef SERIALIZATION_INSTRUMENTATION
+    Serialization::JSONSerializer serializer;
+    for (const Serialization::TypeInstrumentation::Statistics& statistics : Serialization::TypeInstrumentation::collect()) {
+        serializer.serialize(std::cout, statistics);
+        std::cout << std::endl;
+    }
+#endif
+
+    return 0;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,104 @@
+/**
+ * @file BenchmarkResult.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief name and measurements of a benchmark case
+ * @version 1.0
+ * @date 2020-08-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BENCHMARKRESULT_H__
+#define __BENCHMARKRESULT_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Benchmark
+{
+struct BenchmarkCase;
+struct BenchmarkResult;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Descriptor.h"
+#include <cstdint>
+#include <optional>
+
+namespace Benchmark
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief what a benchmark case measures
+ */
+struct BenchmarkCase
+{
+    /** serialize, serializeStructure, deserialize or the measured feature, e.g. format */
+    const char* operation;
+    /** json, static-json, binary, tagged or the measured implementation, e.g. to_chars */
+    const char* format;
+    /** name of the measured class */
+    const char* shape;
+    /** where the output goes or the input comes from */
+    const char* sink;
+};
+
+/**
+ * @brief measurements of a benchmark case, written as one line of json
+ */
+struct BenchmarkResult
+{
+    const char* operation;
+    const char* format;
+    const char* shape;
+    const char* sink;
+    /** operations per sample */
+    std::uint64_t iterations;
+    /** number of timed samples */
+    std::uint64_t samples;
+    /** built with SERIALIZATION_INSTRUMENTATION */
+    bool instrumented;
+    /** median over the samples */
+    double nsPerOp;
+    /** fastest sample */
+    double minNsPerOp;
+    /** bytes written or read per operation */
+    double bytesPerOp;
+    /** bytes per operation at the median time */
+    double bytesPerSecond;
+    /** heap allocations per operation over all samples */
+    double allocationsPerOp;
+    /** hardware counters per operation over all samples, null if not counted */
+    std::optional<double> cyclesPerOp;
+    std::optional<double> instructionsPerOp;
+    std::optional<double> branchMissesPerOp;
+    std::optional<double> l1dMissesPerOp;
+    std::optional<double> l1iMissesPerOp;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "BenchmarkResult",
+        &BenchmarkResult::operation, "operation",
+        &BenchmarkResult::format, "format",
+        &BenchmarkResult::shape, "shape",
+        &BenchmarkResult::sink, "sink",
+        &BenchmarkResult::iterations, "iterations",
+        &BenchmarkResult::samples, "samples",
+        &BenchmarkResult::instrumented, "instrumented",
+        &BenchmarkResult::nsPerOp, "nsPerOp",
+        &BenchmarkResult::minNsPerOp, "minNsPerOp",
+        &BenchmarkResult::bytesPerOp, "bytesPerOp",
+        &BenchmarkResult::bytesPerSecond, "bytesPerSecond",
+        &BenchmarkResult::allocationsPerOp, "allocationsPerOp",
+        &BenchmarkResult::cyclesPerOp, "cyclesPerOp",
+        &BenchmarkResult::instructionsPerOp, "instructionsPerOp",
+        &BenchmarkResult::branchMissesPerOp, "branchMissesPerOp",
+        &BenchmarkResult::l1dMissesPerOp, "l1dMissesPerOp",
+        &BenchmarkResult::l1iMissesPerOp, "l1iMissesPerOp"
+    );
+};
+} // Benchmark
+#endif //__BENCHMARKRESULT_H__
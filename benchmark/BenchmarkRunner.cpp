@@ -0,0 +1,182 @@
+/**
+ * @file BenchmarkRunner.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief times benchmark cases and reports them as json lines
+ * @version 1.0
+ * @date 2020-08-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchmarkRunner.h"
+#include <algorithm>
+#include <vector>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a new Benchmark Runner
+ *
+ * @param os receives one line of json per case
+ * @param filter only cases whose name operation/format/shape/sink contains this run
+ * @param samples timed samples per case, at least one
+ * @param sampleTime minimum duration of a sample
+ * @param counters hardware counters to read around the samples, nullptr for none
+ */
+inline Benchmark::BenchmarkRunner::BenchmarkRunner(
+    std::ostream& os,
+    const std::string& filter,
+    const std::size_t samples,
+    const std::chrono::nanoseconds sampleTime,
+    PerfCounters* const counters) :
+    os(os), filter(filter), samples(std::max<std::size_t>(samples, 1)), sampleTime(sampleTime),
+    counters(counters), bytes(0), serializer()
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Measures a case and reports it, unless it is filtered out.
+ *
+ * @tparam OperationT callable without arguments returning the bytes written or read
+ * @param benchmarkCase name of the case
+ * @param operation operation to measure
+ */
+template <class OperationT>
+void Benchmark::BenchmarkRunner::run(const BenchmarkCase& benchmarkCase, OperationT&& operation)
+{
+    if (!isSelected(benchmarkCase)) {
+        return;
+    }
+
+    std::size_t iterations = 1;
+    while ((measure(operation, iterations) < sampleTime) && (iterations < maxIterations)) {
+        iterations *= 2;
+    }
+
+    std::vector<double> times(samples);
+    const std::size_t allocationsBefore = allocations.load(std::memory_order_relaxed);
+    if (counters != nullptr) {
+        counters->start();
+    }
+    for (double& time : times) {
+        time = static_cast<double>(measure(operation, iterations).count()) / iterations;
+    }
+    if (counters != nullptr) {
+        counters->stop();
+    }
+    const std::size_t allocated = allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+    std::sort(times.begin(), times.end());
+    const double median = (samples % 2 == 1) ?
+        times[samples / 2] :
+        (times[samples / 2 - 1] + times[samples / 2]) / 2;
+    const double bytesPerOp = static_cast<double>(bytes) / iterations;
+
+    report(BenchmarkResult{
+        benchmarkCase.operation,
+        benchmarkCase.format,
+        benchmarkCase.shape,
+        benchmarkCase.sink,
+        iterations,
+        samples,
+        Serialization::Instrumentation::isEnabled,
+        median,
+        times.front(),
+        bytesPerOp,
+        (median > 0) ? bytesPerOp * 1e9 / median : 0.0,
+        static_cast<double>(allocated) / (samples * iterations),
+        getCountPerOp(PerfCounters::Event::Cycles, samples * iterations),
+        getCountPerOp(PerfCounters::Event::Instructions, samples * iterations),
+        getCountPerOp(PerfCounters::Event::BranchMisses, samples * iterations),
+        getCountPerOp(PerfCounters::Event::L1dMisses, samples * iterations),
+        getCountPerOp(PerfCounters::Event::L1iMisses, samples * iterations)});
+}
+
+/**
+ * @brief counts a heap allocation, called by the replaced operator new
+ */
+inline void Benchmark::BenchmarkRunner::countAllocation()
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief checks the case name operation/format/shape/sink against the filter
+ *
+ * @param benchmarkCase name of the case
+ * @return true if the case runs
+ */
+inline bool Benchmark::BenchmarkRunner::isSelected(const BenchmarkCase& benchmarkCase) const
+{
+    if (filter.empty()) {
+        return true;
+    }
+    const std::string name = std::string(benchmarkCase.operation) + "/" + benchmarkCase.format + "/" +
+        benchmarkCase.shape + "/" + benchmarkCase.sink;
+    return name.find(filter) != std::string::npos;
+}
+
+/**
+ * @brief runs the operation a number of times and keeps the bytes it reported.
+ *
+ * @tparam OperationT callable without arguments returning the bytes written or read
+ * @param operation operation to measure
+ * @param iterations how often to run it
+ * @return std::chrono::nanoseconds time of all iterations
+ */
+template <class OperationT>
+std::chrono::nanoseconds Benchmark::BenchmarkRunner::measure(OperationT& operation, const std::size_t iterations)
+{
+    std::size_t total = 0;
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (std::size_t ii = 0; ii < iterations; ++ii) {
+        total += operation();
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    bytes = total;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+}
+
+/**
+ * @brief divides the count of an event by the operations of the samples
+ *
+ * @param event event to get
+ * @param operations operations of all samples
+ * @return std::optional<double> count per operation, empty if not counted
+ */
+inline std::optional<double> Benchmark::BenchmarkRunner::getCountPerOp(
+    const PerfCounters::Event event,
+    const std::size_t operations) const
+{
+    if (counters == nullptr) {
+        return std::nullopt;
+    }
+    const std::optional<double> count = counters->getCount(event);
+    return count ? std::optional<double>(*count / operations) : std::nullopt;
+}
+
+/**
+ * @brief writes a result as one line of json
+ *
+ * @param result measurements of a case
+ */
+inline void Benchmark::BenchmarkRunner::report(const BenchmarkResult& result)
+{
+    serializer.serialize(os, result);
+    os << std::endl;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,107 @@
+/**
+ * @file BenchmarkRunner.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief times benchmark cases and reports them as json lines
+ * @version 1.0
+ * @date 2020-08-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BENCHMARKRUNNER_H__
+#define __BENCHMARKRUNNER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Benchmark
+{
+class BenchmarkRunner;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchmarkResult.h"
+#include "Instrumentation.h"
+#include "PerfCounters.h"
+#include "SerializerJSON.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace Benchmark
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief times benchmark cases and reports them as json lines
+ *
+ * @details Every case is an operation returning the bytes it wrote or
+ * read. The number of iterations is doubled until a sample takes at least
+ * the sample time, which also warms up caches and buffers, then the given
+ * number of samples is timed. Reports the median and the fastest sample,
+ * and the heap allocations seen by countAllocation() during the samples.
+ * If PerfCounters are given, they count the samples as well, so cycles,
+ * instructions and misses are reported per operation; events the counters
+ * do not have are reported as null.
+ * Each result is one line of json, so runs of different commits diff
+ * line by line.
+ */
+class BenchmarkRunner
+{
+    // delete default constructors
+    BenchmarkRunner() = delete;
+    BenchmarkRunner(const BenchmarkRunner& other) = delete;
+    BenchmarkRunner& operator=(const BenchmarkRunner& other) = delete;
+public:
+    BenchmarkRunner(
+        std::ostream& os,
+        const std::string& filter,
+        const std::size_t samples,
+        const std::chrono::nanoseconds sampleTime,
+        PerfCounters* const counters = nullptr);
+
+    template <class OperationT>
+    void run(const BenchmarkCase& benchmarkCase, OperationT&& operation);
+
+    static void countAllocation();
+
+private:
+    /** upper bound for the iterations of a sample, for operations the clock can not resolve */
+    static constexpr std::size_t maxIterations = std::size_t(1) << 30;
+
+    bool isSelected(const BenchmarkCase& benchmarkCase) const;
+
+    template <class OperationT>
+    std::chrono::nanoseconds measure(OperationT& operation, const std::size_t iterations);
+
+    std::optional<double> getCountPerOp(const PerfCounters::Event event, const std::size_t operations) const;
+    void report(const BenchmarkResult& result);
+
+    /** heap allocations of the whole program */
+    static inline std::atomic<std::size_t> allocations{0};
+
+    /** receives the results */
+    std::ostream& os;
+    /** only cases whose name contains this run, all if empty */
+    const std::string filter;
+    /** timed samples per case */
+    const std::size_t samples;
+    /** minimum duration of a sample */
+    const std::chrono::nanoseconds sampleTime;
+    /** counts the samples, nullptr to not count */
+    PerfCounters* const counters;
+    /** bytes of the last measurement */
+    std::size_t bytes;
+    /** writes the results */
+    Serialization::JSONSerializer serializer;
+};
+} // Benchmark
+
+// include src
+#include "BenchmarkRunner.cpp"
+#endif //__BENCHMARKRUNNER_H__
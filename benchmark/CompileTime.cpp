@@ -0,0 +1,255 @@
+/**
+ * @file CompileTime.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compile time benchmark of classes with many described members
+ * @version 1.0
+ * @date 2020-09-03
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ * Build from the repository root with
+ *     g++ -std=c++2a -O2 -I. benchmark/CompileTime.cpp -o benchmark/compile-time
+ * and run from there with [--compiler=c++] [--members=10,100,500] [--repeat=n].
+ * Generates a class for every member count, compiles it with the
+ * descriptor only (describe) and with all formats instantiated
+ * (serialize), and prints the compile time and peak memory of the
+ * compiler as one line of json per class and stage.
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Descriptor.h"
+#include "SerializerJSON.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#ifdef __linux__
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/**
+ * @brief measurements of compiling one generated class, written as one line of json
+ */
+struct CompileTimeResult
+{
+    /** describe or serialize */
+    const char* stage;
+    /** described members of the generated class */
+    std::uint64_t members;
+    /** whether the compiler succeeded */
+    bool compiled;
+    /** fastest wall clock time of all repetitions */
+    double seconds;
+    /** user and system time of the fastest repetition */
+    double cpuSeconds;
+    /** peak resident memory of the compiler */
+    std::uint64_t maxRssKiB;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "CompileTimeResult",
+        &CompileTimeResult::stage, "stage",
+        &CompileTimeResult::members, "members",
+        &CompileTimeResult::compiled, "compiled",
+        &CompileTimeResult::seconds, "seconds",
+        &CompileTimeResult::cpuSeconds, "cpuSeconds",
+        &CompileTimeResult::maxRssKiB, "maxRssKiB"
+    );
+};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** types of the generated members, in turn */
+static constexpr const char* memberTypes[] = {"std::int32_t", "double", "bool", "std::string"};
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief writes a translation unit with one described class.
+ *
+ * @details Every member has a name and an id, like generated message
+ * classes. The serialize stage also instantiates writing and reading
+ * in json, binary and tagged format.
+ *
+ * @param members number of members
+ * @param serialize whether to instantiate the serializers
+ * @return std::string source code
+ */
+std::string generate(const std::size_t members, const bool serialize)
+{
+    std::ostringstream source;
+    source << "#include \"Descriptor.h\"\n";
+    if (serialize) {
+        source << "#include \"BufferWriter.h\"\n"
+            "#include \"DeserializerBinary.h\"\n"
+            "#include \"DeserializerJSON.h\"\n"
+            "#include \"DeserializerTagged.h\"\n"
+            "#include \"SerializerBinary.h\"\n"
+            "#include \"SerializerJSON.h\"\n"
+            "#include \"SerializerTagged.h\"\n";
+    }
+    source << "#include <cstdint>\n#include <string>\n\nstruct Generated\n{\n";
+    for (std::size_t ii = 0; ii < members; ++ii) {
+        source << "    " << memberTypes[ii % std::size(memberTypes)] << " field" << ii << ";\n";
+    }
+    source << "\n    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(\n"
+        "        \"Generated\"";
+    for (std::size_t ii = 0; ii < members; ++ii) {
+        source << ",\n        &Generated::field" << ii << ", \"field" << ii << "\", " << (ii + 1);
+    }
+    source << "\n    );\n};\n\n"
+        "static_assert(Serialization::Descriptor::getDescriptorCount<Generated>() == " << members << ");\n"
+        "static_assert(Generated::descriptor.findDescriptor(\"field" << (members - 1) << "\", " <<
+        (std::to_string(members - 1).size() + 5) << ") == " << (members - 1) << ");\n";
+    if (serialize) {
+        source << "\n"
+            "template <class SerializerT, class DeserializerT>\n"
+            "bool roundTrip(Generated& object)\n"
+            "{\n"
+            "    Serialization::BufferWriter writer;\n"
+            "    SerializerT().serialize(writer, object);\n"
+            "    return static_cast<bool>(DeserializerT().deserialize(writer.getData(), writer.getSize(), object));\n"
+            "}\n"
+            "\n"
+            "bool roundTripAll(Generated& object)\n"
+            "{\n"
+            "    return roundTrip<Serialization::JSONSerializer, Serialization::JSONDeserializer>(object) &&\n"
+            "        roundTrip<Serialization::BinarySerializer, Serialization::BinaryDeserializer>(object) &&\n"
+            "        roundTrip<Serialization::TaggedSerializer, Serialization::TaggedDeserializer>(object);\n"
+            "}\n";
+    }
+    return source.str();
+}
+
+/**
+ * @brief compiles a source file to an object that is thrown away.
+ *
+ * @details The compiler runs as child process, so wait4(2) reports the
+ * time and peak memory of this compilation alone. Without Linux nothing
+ * is compiled.
+ *
+ * @param compiler compiler to call, found through PATH
+ * @param source file to compile
+ * @param stage name of the stage
+ * @param members number of members of the generated class
+ * @return CompileTimeResult measurements
+ */
+CompileTimeResult compile(
+    const std::string& compiler,
+    const std::filesystem::path& source,
+    const char* const stage,
+    const std::size_t members)
+{
+    CompileTimeResult result{stage, members, false, 0.0, 0.0, 0};
+#ifdef __linux__
+    const std::string include = "-I" + std::filesystem::current_path().string();
+    const std::string file = source.string();
+    std::vector<std::string> arguments = {compiler, "-std=c++2a", "-O2", include, "-c", file, "-o", "/dev/null"};
+    std::vector<char*> argumentPointers;
+    for (std::string& argument : arguments) {
+        argumentPointers.push_back(argument.data());
+    }
+    argumentPointers.push_back(nullptr);
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    pid_t child;
+    if (posix_spawnp(&child, compiler.c_str(), nullptr, nullptr, argumentPointers.data(), environ) != 0) {
+        return result;
+    }
+    int status = 0;
+    rusage usage{};
+    if (wait4(child, &status, 0, &usage) != child) {
+        return result;
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    result.compiled = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    result.cpuSeconds = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+        (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+    result.maxRssKiB = usage.ru_maxrss;
+#endif
+    return result;
+}
+
+/**
+ * @brief reads a comma separated list of numbers
+ *
+ * @param list numbers like 10,100,500
+ * @return std::vector<std::size_t> the numbers, 0 for anything unreadable
+ */
+std::vector<std::size_t> readList(const std::string_view list)
+{
+    std::vector<std::size_t> numbers;
+    std::size_t begin = 0;
+    while (begin <= list.size()) {
+        const std::size_t end = std::min(list.find(',', begin), list.size());
+        std::size_t number = 0;
+        std::from_chars(list.data() + begin, list.data() + end, number);
+        numbers.push_back(number);
+        begin = end + 1;
+    }
+    return numbers;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string compiler = "c++";
+    std::vector<std::size_t> memberCounts = {10, 100, 500};
+    std::size_t repeat = 1;
+    for (int ii = 1; ii < argc; ++ii) {
+        const std::string_view argument = argv[ii];
+        if (argument.substr(0, 11) == "--compiler=") {
+            compiler = argument.substr(11);
+        } else if (argument.substr(0, 10) == "--members=") {
+            memberCounts = readList(argument.substr(10));
+        } else if (argument.substr(0, 9) == "--repeat=") {
+            repeat = std::max<std::size_t>(readList(argument.substr(9)).front(), 1);
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--compiler=c++] [--members=10,100,500] [--repeat=n]" << std::endl;
+            return 1;
+        }
+    }
+
+    Serialization::JSONSerializer serializer;
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    for (const std::size_t members : memberCounts) {
+        for (const bool serialize : {false, true}) {
+            const char* const stage = serialize ? "serialize" : "describe";
+            const std::filesystem::path source =
+                directory / ("compile-time-" + std::to_string(members) + "-" + stage + ".cpp");
+            std::ofstream(source) << generate(members, serialize);
+
+            CompileTimeResult fastest = compile(compiler, source, stage, members);
+            for (std::size_t run = 1; fastest.compiled && (run < repeat); ++run) {
+                const CompileTimeResult result = compile(compiler, source, stage, members);
+                if (result.seconds < fastest.seconds) {
+                    fastest = result;
+                }
+            }
+            std::filesystem::remove(source);
+
+            serializer.serialize(std::cout, fastest);
+            std::cout << std::endl;
+        }
+    }
+    return 0;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
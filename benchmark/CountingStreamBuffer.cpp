@@ -0,0 +1,62 @@
+/**
+ * @file CountingStreamBuffer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief stream buffer that drops its output and counts the bytes
+ * @version 1.0
+ * @date 2020-08-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "CountingStreamBuffer.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+inline Benchmark::CountingStreamBuffer::CountingStreamBuffer() :
+    std::streambuf(), count(0)
+{
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief gets the number of bytes written since the last reset()
+ *
+ * @return std::size_t bytes
+ */
+inline std::size_t Benchmark::CountingStreamBuffer::getCount() const
+{
+    return count;
+}
+
+inline void Benchmark::CountingStreamBuffer::reset()
+{
+    count = 0;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+inline std::streamsize Benchmark::CountingStreamBuffer::xsputn(const char* const data, const std::streamsize size)
+{
+    count += static_cast<std::size_t>(size);
+    return size;
+}
+
+inline Benchmark::CountingStreamBuffer::int_type Benchmark::CountingStreamBuffer::overflow(const int_type character)
+{
+    if (!traits_type::eq_int_type(character, traits_type::eof())) {
+        ++count;
+    }
+    return traits_type::not_eof(character);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,62 @@
+/**
+ * @file CountingStreamBuffer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief stream buffer that drops its output and counts the bytes
+ * @version 1.0
+ * @date 2020-08-31
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __COUNTINGSTREAMBUFFER_H__
+#define __COUNTINGSTREAMBUFFER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Benchmark
+{
+class CountingStreamBuffer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstddef>
+#include <streambuf>
+
+namespace Benchmark
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief stream buffer that drops its output and counts the bytes
+ *
+ * @details Measures the std::ostream path of the serializers without
+ * the cost of a file or a growing string.
+ */
+class CountingStreamBuffer : public std::streambuf
+{
+    // delete default constructors
+    CountingStreamBuffer(const CountingStreamBuffer& other) = delete;
+    CountingStreamBuffer& operator=(const CountingStreamBuffer& other) = delete;
+public:
+    CountingStreamBuffer();
+
+    std::size_t getCount() const;
+    void reset();
+
+protected:
+    virtual std::streamsize xsputn(const char* const data, const std::streamsize size) override;
+    virtual int_type overflow(const int_type character) override;
+
+private:
+    /** bytes written since the last reset() */
+    std::size_t count;
+};
+} // Benchmark
+
+// include src
+#include "CountingStreamBuffer.cpp"
+#endif //__COUNTINGSTREAMBUFFER_H__
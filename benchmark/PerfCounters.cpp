@@ -0,0 +1,171 @@
+/**
+ * @file PerfCounters.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief hardware performance counters of the calling thread
+ * @version 1.0
+ * @date 2020-09-01
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "PerfCounters.h"
+#include <cerrno>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief opens the counters for the calling thread, disabled
+ */
+inline Benchmark::PerfCounters::PerfCounters() :
+    descriptors(), counts(), error(0)
+{
+    descriptors.fill(-1);
+
+#ifdef __linux__
+    constexpr auto cacheMiss = [](const std::uint64_t cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+    // type and config of each Event
+    constexpr std::array<std::array<std::uint64_t, 2>, eventCount> events = {{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+        {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1I)}}};
+
+    for (std::size_t ii = 0; ii < eventCount; ++ii) {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = static_cast<std::uint32_t>(events[ii][0]);
+        attributes.config = events[ii][1];
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        descriptors[ii] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        if ((descriptors[ii] < 0) && (error == 0)) {
+            error = errno;
+        }
+    }
+#else
+    error = ENOSYS;
+#endif
+}
+
+inline Benchmark::PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (const int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+    }
+#endif
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief checks if any counter could be opened
+ *
+ * @return true if at least one event is counted
+ */
+inline bool Benchmark::PerfCounters::isAvailable() const
+{
+    for (const int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool Benchmark::PerfCounters::isAvailable(const Event event) const
+{
+    return descriptors[static_cast<std::size_t>(event)] >= 0;
+}
+
+/**
+ * @brief gets why a counter could not be opened
+ *
+ * @return int errno of the first counter that failed, 0 if all are open
+ */
+inline int Benchmark::PerfCounters::getError() const
+{
+    return error;
+}
+
+/**
+ * @brief resets and enables the counters
+ */
+inline void Benchmark::PerfCounters::start()
+{
+#ifdef __linux__
+    for (const int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+/**
+ * @brief disables the counters and reads them
+ */
+inline void Benchmark::PerfCounters::stop()
+{
+#ifdef __linux__
+    for (const int descriptor : descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (std::size_t ii = 0; ii < eventCount; ++ii) {
+        // value, time enabled, time running
+        std::uint64_t values[3] = {};
+        counts[ii] = 0;
+        if ((descriptors[ii] >= 0) && (read(descriptors[ii], values, sizeof(values)) == sizeof(values)) &&
+            (values[2] != 0)) {
+            counts[ii] = static_cast<double>(values[0]) * values[1] / values[2];
+        }
+    }
+#endif
+}
+
+/**
+ * @brief gets the count of an event between the last start() and stop()
+ *
+ * @param event event to get
+ * @return std::optional<double> count, empty if the event is not available
+ */
+inline std::optional<double> Benchmark::PerfCounters::getCount(const Event event) const
+{
+    if (!isAvailable(event)) {
+        return std::nullopt;
+    }
+    return counts[static_cast<std::size_t>(event)];
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,88 @@
+/**
+ * @file PerfCounters.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief hardware performance counters of the calling thread
+ * @version 1.0
+ * @date 2020-09-01
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __PERFCOUNTERS_H__
+#define __PERFCOUNTERS_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Benchmark
+{
+class PerfCounters;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Benchmark
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief hardware performance counters of the calling thread
+ *
+ * @details Opens one Linux perf_event_open(2) counter per event, user
+ * space only. Each event is opened on its own, so a CPU or container
+ * that lacks some of them, or forbids them all through
+ * perf_event_paranoid or seccomp, still counts the rest. Events that could
+ * not be opened read as empty. Counts are scaled up if the kernel had to
+ * multiplex the counters. Without Linux nothing is available.
+ */
+class PerfCounters
+{
+    // delete default constructors
+    PerfCounters(const PerfCounters& other) = delete;
+    PerfCounters& operator=(const PerfCounters& other) = delete;
+public:
+    /** counted events */
+    enum class Event : std::size_t
+    {
+        Cycles,
+        Instructions,
+        BranchMisses,
+        L1dMisses,
+        L1iMisses
+    };
+
+    /** number of events */
+    static constexpr std::size_t eventCount = 5;
+
+    PerfCounters();
+    ~PerfCounters();
+
+    bool isAvailable() const;
+    bool isAvailable(const Event event) const;
+    int getError() const;
+
+    void start();
+    void stop();
+
+    std::optional<double> getCount(const Event event) const;
+
+private:
+    /** descriptor of each counter, -1 if it could not be opened */
+    std::array<int, eventCount> descriptors;
+    /** counts of the last start() and stop() */
+    std::array<double, eventCount> counts;
+    /** errno of the first counter that could not be opened, 0 if none */
+    int error;
+};
+} // Benchmark
+
+// include src
+#include "PerfCounters.cpp"
+#endif //__PERFCOUNTERS_H__
@@ -11,15 +11,35 @@
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include "Arena.h"
+#include "BufferWriter.h"
+#include "CallDispatcher.h"
 #include "Descriptor.h"
+#include "DeserializerBinary.h"
+#include "DeserializerDelta.h"
+#include "DeserializerJSON.h"
+#include "DeserializerTagged.h"
+#include "InSituResult.h"
+#include "IncrementalDeserializer.h"
+#include "RecordFileReader.h"
+#include "RecordFileWriter.h"
+#include "SerializerBinary.h"
+#include "SerializerDelta.h"
 #include "SerializerJSON.h"
+#include "SerializerTagged.h"
+#include "StaticSerializerJSON.h"
 #include <iostream>
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
-
-#include <chrono>
-#include <fstream>
-#include <numeric>
+#include <cstdint>
+#include <cstdio>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -78,6 +98,234 @@ public:
     );
 };
 
+/**
+ * @brief plain message, its memory equals the binary encoding
+ */
+struct SensorSample
+{
+    int timestamp;
+    int value;
+    char channel;
+    char unit;
+    char quality;
+    char flags;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "SensorSample",
+        &SensorSample::timestamp, "timestamp",
+        &SensorSample::value, "value",
+        &SensorSample::channel, "channel",
+        &SensorSample::unit, "unit",
+        &SensorSample::quality, "quality",
+        &SensorSample::flags, "flags"
+    );
+};
+
+/**
+ * @brief message with container members, the samples are written in bulk
+ */
+struct Telemetry
+{
+    std::string device;
+    std::array<int, 3> position;
+    std::optional<int> battery;
+    std::vector<int> samples;
+    std::vector<SensorSample> events;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Telemetry",
+        &Telemetry::device, "device",
+        &Telemetry::position, "position",
+        &Telemetry::battery, "battery",
+        &Telemetry::samples, "samples",
+        &Telemetry::events, "events"
+    );
+};
+
+/**
+ * @brief message with fixed width integers and floating points
+ */
+struct Measurement
+{
+    std::int64_t time;
+    std::uint32_t sequence;
+    std::uint8_t channel;
+    float gain;
+    double value;
+    std::vector<double> spectrum;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Measurement",
+        &Measurement::time, "time", 1,
+        &Measurement::sequence, "sequence", 2,
+        &Measurement::channel, "channel", 3,
+        &Measurement::gain, "gain", 4,
+        &Measurement::value, "value", 5,
+        &Measurement::spectrum, "spectrum", 6
+    );
+};
+
+/**
+ * @brief Measurement as an older release described it, before channel,
+ * gain and spectrum were added
+ */
+struct LegacyMeasurement
+{
+    std::int64_t time;
+    std::uint32_t sequence;
+    double value;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Measurement",
+        &LegacyMeasurement::time, "time", 1,
+        &LegacyMeasurement::sequence, "sequence", 2,
+        &LegacyMeasurement::value, "value", 5
+    );
+};
+
+/**
+ * @brief log line with owning strings, each longer than the small string buffer
+ */
+struct AccessLog
+{
+    std::string host;
+    std::string path;
+    std::string agent;
+    int status;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "AccessLog",
+        &AccessLog::host, "host",
+        &AccessLog::path, "path",
+        &AccessLog::agent, "agent",
+        &AccessLog::status, "status"
+    );
+};
+
+/**
+ * @brief same log line viewing the input, deserialized in situ
+ */
+struct AccessLogView
+{
+    std::string_view host;
+    std::string_view path;
+    const char* agent;
+    int status;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "AccessLogView",
+        &AccessLogView::host, "host",
+        &AccessLogView::path, "path",
+        &AccessLogView::agent, "agent",
+        &AccessLogView::status, "status"
+    );
+};
+
+/**
+ * @brief access log entry owning its strings, allocated from an Arena
+ */
+struct AccessLogEntry
+{
+    std::pmr::string host;
+    std::pmr::string path;
+    std::pmr::vector<std::pmr::string> headers;
+    int status;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "AccessLogEntry",
+        &AccessLogEntry::host, "host",
+        &AccessLogEntry::path, "path",
+        &AccessLogEntry::headers, "headers",
+        &AccessLogEntry::status, "status"
+    );
+};
+
+/**
+ * @brief nested part of DeviceState
+ */
+struct Pose
+{
+    int x;
+    int y;
+    int heading;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Pose",
+        &Pose::x, "x",
+        &Pose::y, "y",
+        &Pose::heading, "heading"
+    );
+};
+
+/**
+ * @brief periodic state message, most members stay the same from tick to tick
+ */
+struct DeviceState
+{
+    std::string name;
+    std::uint64_t tick;
+    int temperature;
+    char mode;
+    bool charging;
+    Pose pose;
+    std::vector<int> errors;
+    std::array<double, 4> calibration;
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "DeviceState",
+        &DeviceState::name, "name",
+        &DeviceState::tick, "tick",
+        &DeviceState::temperature, "temperature",
+        &DeviceState::mode, "mode",
+        &DeviceState::charging, "charging",
+        &DeviceState::pose, "pose",
+        &DeviceState::errors, "errors",
+        &DeviceState::calibration, "calibration"
+    );
+};
+
+/**
+ * @brief controller whose functions are called by remote requests
+ */
+struct Thermostat
+{
+    int target;
+    double offset;
+    bool holding;
+
+    int setTarget(int value)
+    {
+        const int previous = target;
+        target = value;
+        return previous;
+    }
+
+    double calibrate(double measured, std::int16_t samples)
+    {
+        offset += (measured - target / 10.0 - offset) / samples;
+        return offset;
+    }
+
+    void hold(bool enabled)
+    {
+        holding = enabled;
+    }
+
+    static constexpr auto descriptor = Serialization::Descriptor::makeClassDescriptor(
+        "Thermostat",
+        &Thermostat::target, "target",
+        &Thermostat::offset, "offset",
+        &Thermostat::holding, "holding",
+        &Thermostat::setTarget, "setTarget", std::array<const char* const, 1>({"value"}),
+        &Thermostat::calibrate, "calibrate", std::array<const char* const, 2>({"measured", "samples"}),
+        &Thermostat::hold, "hold", std::array<const char* const, 1>({"enabled"})
+    );
+};
+
+static_assert(Serialization::BinaryEncoding::isBulkDecodable<SensorSample>() ||
+    (std::endian::native != std::endian::little), "SensorSample should be copied as a whole");
+static_assert(!Serialization::BinaryEncoding::isBulkEncodable<MyClass>(), "MyClass holds a pointer");
+
 //-------------------------------- CONSTANTS ----------------------------------
 
 //------------------------------ CONSTRUCTOR ----------------------------------
@@ -98,39 +346,189 @@ int main(int argc, char* argv[], char* env[])
     s1.serializeStructure<MyClass>(std::cout);
     std::cout << std::endl;
 
-    // test time
-    std::ofstream myfile;
-    constexpr size_t count = 1e5;
-    constexpr size_t runs = 1e2;
-
-    std::array<long int, runs> times;
-
-    for (size_t run = 0; run < runs; ++run) {
-        myfile.open("/dev/null");
-        myfile << "{";
-        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
-        for (size_t ii = 0; ii < count; ++ii) {
-            s1.serialize(myfile, mc1);
-            if (ii < (count - 1))
-            {
-            myfile << ",";
-            }
-        }
-        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-        myfile << "}";
-        myfile.close();
-        times[run] = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    Serialization::StaticJSONSerializer s2;
+
+    s2.serialize(std::cout, mc1);
+    std::cout << std::endl;
+    s2.serializeStructure<MyClass>(std::cout);
+    std::cout << std::endl;
+
+    const std::array<MyClass, 2> both = {mc1, mc2};
+    s1.serializeRange(std::cout, both);
+    std::cout << std::endl;
+    s2.serializeRange(std::cout, both);
+    std::cout << std::endl;
+
+    // read mc1 back into mc2, the const member d keeps its value
+    Serialization::BufferWriter json;
+    s1.serialize(json, mc1);
+    Serialization::JSONDeserializer d1;
+    const auto result = d1.deserialize(json.getData(), json.getSize(), mc2);
+    std::cout << "Deserialized " << result.getPosition() << " bytes: " <<
+        Serialization::DeserializationResult::getDescription(result.getError()) << std::endl;
+    s1.serialize(std::cout, mc2);
+    std::cout << std::endl;
+
+    // same round trip in binary
+    Serialization::BinarySerializer s3;
+    Serialization::BufferWriter binary;
+    s3.serialize(binary, mc2);
+    Serialization::BinaryDeserializer d2;
+    MyClass mc3{0, '0', 0, "Binary", false};
+    const auto binaryResult = d2.deserialize(binary.getData(), binary.getSize(), mc3);
+    std::cout << "Deserialized " << binaryResult.getPosition() << " binary bytes: " <<
+        Serialization::DeserializationResult::getDescription(binaryResult.getError()) << std::endl;
+    s1.serialize(std::cout, mc3);
+    std::cout << std::endl;
+
+    // container members
+    Telemetry telemetry{"sensor-\"7\"", {1, -2, 3}, std::nullopt, {4, 5, 6}, {SensorSample{7, 8, 'a', 'V', 'g', 0}}};
+    s1.serialize(std::cout, telemetry);
+    std::cout << std::endl;
+    s2.serializeStructure<Telemetry>(std::cout);
+    std::cout << std::endl;
+    Serialization::BufferWriter telemetryBinary;
+    s3.serialize(telemetryBinary, telemetry);
+    Telemetry telemetryCopy{"", {}, 1, {}, {}};
+    const auto telemetryResult = d2.deserialize(telemetryBinary.getData(), telemetryBinary.getSize(), telemetryCopy);
+    std::cout << "Deserialized " << telemetryResult.getPosition() << " binary bytes: " <<
+        Serialization::DeserializationResult::getDescription(telemetryResult.getError()) << std::endl;
+    s2.serialize(std::cout, telemetryCopy);
+    std::cout << std::endl;
+
+    // fixed width integers and floating points, NaN has no json representation
+    Measurement measurement{-1600000000000, 4000000000u, 200, 0.1f, 1.0 / 3, {1e-300, -0.0, 2.5e20, NAN}};
+    s1.serialize(std::cout, measurement);
+    std::cout << std::endl;
+    s2.serializeStructure<Measurement>(std::cout);
+    std::cout << std::endl;
+    Serialization::BufferWriter measurementBinary;
+    s3.serialize(measurementBinary, measurement);
+    Measurement measurementCopy{};
+    const auto measurementResult = d2.deserialize(measurementBinary.getData(), measurementBinary.getSize(), measurementCopy);
+    std::cout << "Deserialized " << measurementResult.getPosition() << " binary bytes: " <<
+        Serialization::DeserializationResult::getDescription(measurementResult.getError()) << std::endl;
+    s2.serialize(std::cout, measurementCopy);
+    std::cout << std::endl;
+
+    // members are found by id, readers of other releases skip or keep what they do not share
+    Serialization::TaggedSerializer s4;
+    Serialization::TaggedDeserializer d3;
+    Serialization::BufferWriter tagged;
+    s4.serialize(tagged, measurement);
+    LegacyMeasurement legacy{};
+    const auto legacyResult = d3.deserialize(tagged.getData(), tagged.getSize(), legacy);
+    std::cout << "Deserialized " << legacyResult.getPosition() << " tagged bytes with an old reader: " <<
+        Serialization::DeserializationResult::getDescription(legacyResult.getError()) << std::endl;
+    s2.serialize(std::cout, legacy);
+    std::cout << std::endl;
+    Serialization::BufferWriter legacyTagged;
+    s4.serialize(legacyTagged, legacy);
+    Measurement upgraded{0, 0, 7, 1.0f, 0.0, {}};
+    const auto upgradedResult = d3.deserialize(legacyTagged.getData(), legacyTagged.getSize(), upgraded);
+    std::cout << "Deserialized " << upgradedResult.getPosition() << " tagged bytes of an old writer: " <<
+        Serialization::DeserializationResult::getDescription(upgradedResult.getError()) << std::endl;
+    s2.serialize(std::cout, upgraded);
+    std::cout << std::endl;
+
+    // only what changed since the receiver's copy
+    Serialization::DeltaSerializer s5;
+    Serialization::DeltaDeserializer d4;
+    Serialization::BufferWriter delta;
+    MyClass mc4{1, '2', 30, "Delta", false};
+    s5.serialize(delta, mc4, mc1);
+    MyClass receiver = mc1;
+    const auto deltaResult = d4.deserialize(delta.getData(), delta.getSize(), receiver);
+    std::cout << "Applied a delta of " << delta.getSize() << " bytes: " <<
+        Serialization::DeserializationResult::getDescription(deltaResult.getError()) << std::endl;
+    s2.serialize(std::cout, receiver);
+    std::cout << std::endl;
+
+    // described functions called by name, the arguments decoded straight into the call
+    Serialization::CallDispatcher<MyClass> dispatcher;
+    Serialization::BufferWriter returned;
+    MyClass callee = mc1;
+    const std::string call = "{\"fct2\": [7, \"x\"]}";
+    const auto callResult = dispatcher.dispatchJSON(call.data(), call.size(), callee, returned);
+    std::cout << "Called fct2 from json: " <<
+        Serialization::DeserializationResult::getDescription(callResult.getError()) << ", returned " <<
+        std::string_view(returned.getData(), returned.getSize()) << std::endl;
+    Serialization::BufferWriter binaryCall;
+    s3.serialize(binaryCall, std::string_view("fct"));
+    s3.serialize(binaryCall, 41);
+    returned.clear();
+    const auto binaryCallResult = dispatcher.dispatchBinary(binaryCall.getData(), binaryCall.getSize(), callee, returned);
+    int fctResult = 0;
+    d2.deserializePrefix(returned.getData(), returned.getSize(), fctResult);
+    std::cout << "Called fct from binary: " <<
+        Serialization::DeserializationResult::getDescription(binaryCallResult.getError()) << ", returned " <<
+        fctResult << std::endl;
+    const std::string notCallable = "{\"a\": [1]}";
+    const auto notCallableResult = dispatcher.dispatchJSON(notCallable.data(), notCallable.size(), callee, returned);
+    std::cout << "Called a: " <<
+        Serialization::DeserializationResult::getDescription(notCallableResult.getError()) << std::endl;
+
+    // strings viewed in the received buffer, which the result keeps alive
+    const std::string received = "{\"host\":\"edge-1\",\"path\":\"/a\\u00e4\\n\",\"agent\":\"curl\",\"status\":404}";
+    Serialization::InSituResult<AccessLogView> inSitu(std::vector<char>(received.begin(), received.end()), d1);
+    std::cout << "Deserialized in situ: " <<
+        Serialization::DeserializationResult::getDescription(inSitu.getResult().getError()) << std::endl;
+    s2.serialize(std::cout, inSitu.getObject());
+    std::cout << std::endl;
+
+    // owned strings of one message taken from a bump allocator, freed at once
+    Serialization::Arena arena;
+    const std::string logged = "{\"host\":\"edge-1\",\"path\":\"/sensors/temperature/history\","
+        "\"headers\":[\"Accept: application/json\",\"User-Agent: greenhouse-dashboard/2.1\"],\"status\":200}";
+    {
+        AccessLogEntry entry{};
+        const auto arenaResult = d1.deserialize(logged.data(), logged.size(), entry, arena);
+        std::cout << "Deserialized into an arena: " <<
+            Serialization::DeserializationResult::getDescription(arenaResult.getError()) << ", " <<
+            arena.getAllocationCount() << " allocations, " << arena.getSize() << " bytes" << std::endl;
+        s2.serialize(std::cout, entry);
+        std::cout << std::endl;
     }
+    arena.reset();
 
-    auto average = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
-    double stdDeviat = 0.0;
-    for (auto time : times) {
-        stdDeviat += (time-average) * (time-average);
+    // a stream of messages arriving in fragments, each handed out once it is complete
+    Serialization::BufferWriter stream;
+    for (int sample = 7; sample < 10; ++sample) {
+        telemetry.samples.push_back(sample);
+        s1.serialize(stream, telemetry);
+    }
+    Serialization::IncrementalDeserializer<Telemetry, Serialization::JSONDeserializer> streamReader;
+    Serialization::DeserializationResult streamResult(Serialization::DeserializationError::None, 0);
+    for (size_t offset = 0; offset < stream.getSize(); offset += 5) {
+        const size_t fragment = std::min<size_t>(5, stream.getSize() - offset);
+        streamResult = streamReader.push(stream.getData() + offset, fragment, [&s2](Telemetry& received) {
+            s2.serialize(std::cout, received);
+            std::cout << std::endl;
+        });
     }
-    stdDeviat /= (times.size());
-    stdDeviat = sqrt(stdDeviat);
-    std::cout << "Made " << count << " serializations in an average of " <<
-        average << "µs with a standard deviation of " << stdDeviat << "µs" << std::endl;
+    std::cout << "Read " << stream.getSize() << " bytes in fragments of 5 bytes: " <<
+        Serialization::DeserializationResult::getDescription(streamResult.getError()) <<
+        (streamReader.hasPartialObject() ? ", partial message left" : "") << std::endl;
+
+    // records appended to a file, one of them read back by its index
+    constexpr const char* recordPath = "/tmp/serialization-demo.records";
+    Serialization::RecordFileWriter<Measurement> recordWriter;
+    bool recorded = recordWriter.open(recordPath);
+    for (std::uint32_t second = 0; second < 60; ++second) {
+        const Measurement record{1597363200 + second, second, 1, 1.5f, second * 0.25, std::vector<double>(second % 3, 0.5)};
+        recorded = recordWriter.append(record) && recorded;
+    }
+    recorded = recordWriter.close() && recorded;
+    Serialization::RecordFileReader<Measurement> recordReader;
+    Measurement record{};
+    const bool opened = recorded && recordReader.open(recordPath);
+    const auto recordResult = recordReader.read(42, record);
+    std::cout << "Record file with " << recordReader.getCount() << " records" << (opened ? "" : " (WRITE FAILED)") <<
+        ", record 42: " << Serialization::DeserializationResult::getDescription(recordResult.getError()) << std::endl;
+    s2.serialize(std::cout, record);
+    std::cout << std::endl;
+    recordReader.close();
+    std::remove(recordPath);
 
     return 0;
 }